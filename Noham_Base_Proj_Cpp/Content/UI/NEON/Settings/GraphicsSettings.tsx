@@ -4,6 +4,7 @@ import { Select, SelectContent, SelectItem, SelectTrigger, SelectValue } from '@
 import { Slider } from '@/Components/shadcn/slider';
 import { Button } from '@/Components/shadcn/button';
 import { Checkbox } from '@/Components/shadcn/checkbox';
+import { useSettings } from './SettingsContext';
 
 interface GraphicsSettings {
   resolution: { x: number; y: number };
@@ -23,6 +24,14 @@ const GraphicsSettings: React.FC = () => {
   });
 
   const [availableResolutions, setAvailableResolutions] = React.useState<string[]>([]);
+  const { displayCapabilities } = useSettings();
+
+  // Published by Unreal on Settings.Display, also when monitors change while the page is open
+  React.useEffect(() => {
+    if (displayCapabilities?.resolutions?.length) {
+      setAvailableResolutions(displayCapabilities.resolutions.map(r => `${r.x}x${r.y}`));
+    }
+  }, [displayCapabilities]);
 
   React.useEffect(() => {
     // Load current settings from UE5
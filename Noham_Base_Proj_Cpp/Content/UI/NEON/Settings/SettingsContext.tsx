@@ -3,6 +3,8 @@ import React, { createContext, useContext, useState, useEffect } from 'react';
 // NEON TypeScript declarations
 declare const NEON: {
   invokeUnrealEvent(eventName: string, params: object): void;
+  subscribe?(topic: string, callback: (data: any) => void): void;
+  unsubscribe?(topic: string): void;
 };
 
 // Extend Window interface for UE5 event callbacks
@@ -43,10 +45,28 @@ interface InputSettings {
   vibrationIntensity?: number;
 }
 
+// FNohamDisplayCapabilities as published on Settings.Display, field names as UE5 exports them
+interface DisplayMode {
+  resolution: { x: number; y: number };
+  refreshRate: number;
+}
+
+interface DisplayCapabilities {
+  adapterName: string;
+  bHDRSupported: boolean;
+  displayModes: DisplayMode[];
+  resolutions: { x: number; y: number }[];
+  refreshRates: number[];
+  monitors: any[];
+  revision: number;
+}
+
 interface SettingsContextType {
   audioSettings: AudioSettings;
   graphicsSettings: GraphicsSettings;
   inputSettings: InputSettings;
+  // Undefined until Unreal has published them
+  displayCapabilities?: DisplayCapabilities;
   setAudioSettings: (settings: AudioSettings) => void;
   setGraphicsSettings: (settings: GraphicsSettings) => void;
   setInputSettings: (settings: InputSettings) => void;
@@ -56,6 +76,58 @@ interface SettingsContextType {
 
 const SettingsContext = createContext<SettingsContextType | undefined>(undefined);
 
+// The Settings.Graphics/Audio/Input topics carry only the fields that changed, keyed by the UE5 field name with a
+// lowercase first letter (e.g. sFXVolume, bVSyncEnabled). Lowercased UE5 name -> state key, other fields are ignored.
+const audioFields: Record<string, keyof AudioSettings> = {
+  mastervolume: 'masterVolume',
+  musicvolume: 'musicVolume',
+  sfxvolume: 'sfxVolume',
+  voicevolume: 'voiceVolume',
+  selectedaudiodeviceid: 'selectedAudioDeviceId',
+};
+
+const graphicsFields: Record<string, keyof GraphicsSettings> = {
+  resolution: 'resolution',
+  windowmode: 'windowMode',
+  bvsyncenabled: 'vSyncEnabled',
+  frameratelimit: 'frameRateLimit',
+  qualitypreset: 'qualityPreset',
+};
+
+const inputFields: Record<string, keyof InputSettings> = {
+  mousesensitivityx: 'mouseSensitivityX',
+  mousesensitivityy: 'mouseSensitivityY',
+  adssensitivitymultiplier: 'adsSensitivityMultiplier',
+  binvertmousey: 'invertMouseY',
+  gamepadsensitivityx: 'gamepadSensitivityX',
+  gamepadsensitivityy: 'gamepadSensitivityY',
+  binvertgamepady: 'invertGamepadY',
+  leftstickdeadzone: 'leftStickDeadZone',
+  rightstickdeadzone: 'rightStickDeadZone',
+  benablevibration: 'enableVibration',
+  vibrationintensity: 'vibrationIntensity',
+};
+
+const settingsTopics = ['Settings.Graphics', 'Settings.Audio', 'Settings.Input', 'Settings.Display'];
+
+function mapSettingsDelta<T>(delta: any, fields: Record<string, keyof T>): Partial<T> {
+  const mapped: Partial<T> = {};
+  for (const [key, value] of Object.entries(delta ?? {})) {
+    const field = fields[key.toLowerCase()];
+    if (!field) {
+      continue;
+    }
+    // FIntPoint arrives as { x, y } from the topics and as { X, Y } from InitializeSettings
+    if (field === 'resolution' && value && typeof value === 'object') {
+      const point = value as any;
+      mapped[field] = { x: point.x ?? point.X, y: point.y ?? point.Y } as any;
+      continue;
+    }
+    mapped[field] = value as any;
+  }
+  return mapped;
+}
+
 export const SettingsProvider: React.FC<{ children: React.ReactNode }> = ({ children }) => {
   const [audioSettings, setAudioSettings] = useState<AudioSettings>({
     masterVolume: 1.0,
@@ -67,6 +139,7 @@ export const SettingsProvider: React.FC<{ children: React.ReactNode }> = ({ chil
 
   const [graphicsSettings, setGraphicsSettings] = useState<GraphicsSettings>({});
   const [inputSettings, setInputSettings] = useState<InputSettings>({});
+  const [displayCapabilities, setDisplayCapabilities] = useState<DisplayCapabilities | undefined>(undefined);
 
   // Notify UE5 when Settings page opens and listen for responses
   useEffect(() => {
@@ -130,10 +203,30 @@ export const SettingsProvider: React.FC<{ children: React.ReactNode }> = ({ chil
       }
     };
 
+    // STEP 3: Merge changes made elsewhere (keybinds, the quality governor, other menus) while the page is open
+    if (typeof NEON !== 'undefined' && NEON.subscribe) {
+      NEON.subscribe('Settings.Graphics', (delta: any) => {
+        setGraphicsSettings((current) => ({ ...current, ...mapSettingsDelta(delta, graphicsFields) }));
+      });
+      NEON.subscribe('Settings.Audio', (delta: any) => {
+        setAudioSettings((current) => ({ ...current, ...mapSettingsDelta(delta, audioFields) }));
+      });
+      NEON.subscribe('Settings.Input', (delta: any) => {
+        setInputSettings((current) => ({ ...current, ...mapSettingsDelta(delta, inputFields) }));
+      });
+      // The whole set, sent on subscribe and after every display change
+      NEON.subscribe('Settings.Display', (capabilities: DisplayCapabilities) => {
+        setDisplayCapabilities(capabilities);
+      });
+    }
+
     // Cleanup event listeners on unmount
     return () => {
       delete window.InitializeSettings;
       delete window.SettingsReset;
+      if (typeof NEON !== 'undefined' && NEON.unsubscribe) {
+        settingsTopics.forEach((topic) => NEON.unsubscribe!(topic));
+      }
     };
   }, []);
 
@@ -172,6 +265,7 @@ export const SettingsProvider: React.FC<{ children: React.ReactNode }> = ({ chil
         audioSettings,
         graphicsSettings,
         inputSettings,
+        displayCapabilities,
         setAudioSettings,
         setGraphicsSettings,
         setInputSettings,
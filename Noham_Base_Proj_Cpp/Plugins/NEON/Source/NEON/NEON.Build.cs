@@ -63,6 +63,9 @@ public class NEON : ModuleRules
 								"Json",
 								"JsonUtilities",
 								"UMG",
+								"AudioMixer",
+								"AssetRegistry",
+								"SignalProcessing",
 								"Slate",
 								"SlateCore",
 								"InputCore",
@@ -12,8 +12,15 @@
 #include "Misc/MessageDialog.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Misc/Paths.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/App.h"
+#include "Misc/ConfigCacheIni.h"
+#include "RHI.h"
 
+#include "NEONBridgeRecorder.h"
 #include "NEONLogging.h"
+#include "NEONStats.h"
 
 #include "NEONApp.h"
 
@@ -21,6 +28,13 @@ void FNEONModule::StartupModule()
 {
   UE_LOG(LogNEON, Warning, TEXT("Starting NEON module!"));
 
+  _IsHeadless = DetectHeadless();
+  if (_IsHeadless)
+  {
+    UE_LOG(LogNEON, Log, TEXT("NEON running headless. Skipping libcef.dll and CEF initialization."));
+    return;
+  }
+
   FString pluginBaseDir = FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::ProjectPluginsDir()), TEXT("NEON"));
 
   // Load libcef.dll
@@ -104,9 +118,44 @@ void FNEONModule::StartupModule()
   UE_LOG(LogNEON, Log, TEXT("NEON module has started!"));
 }
 
+bool FNEONModule::DetectHeadless()
+{
+  if (FParse::Param(FCommandLine::Get(), TEXT("NEONHeadless")))
+  {
+    UE_LOG(LogNEON, Log, TEXT("Headless: -NEONHeadless"));
+    return true;
+  }
+  if (IsRunningDedicatedServer())
+  {
+    UE_LOG(LogNEON, Log, TEXT("Headless: dedicated server"));
+    return true;
+  }
+  if (IsRunningCommandlet())
+  {
+    UE_LOG(LogNEON, Log, TEXT("Headless: commandlet"));
+    return true;
+  }
+  if (GUsingNullRHI || !FApp::CanEverRender())
+  {
+    UE_LOG(LogNEON, Log, TEXT("Headless: NullRHI / no rendering"));
+    return true;
+  }
+  return false;
+}
+
 void FNEONModule::OnWorldTickStart(UWorld *World, ELevelTick TickType, float DeltaSeconds)
 {
-  CefDoMessageLoopWork();
+  if (!_IsInitialized)
+    return;
+
+  double pumpStart = FPlatformTime::Seconds();
+  {
+    SCOPE_CYCLE_COUNTER(STAT_NEON_Pump);
+    CSV_SCOPED_TIMING_STAT(NEON, Pump);
+    CefDoMessageLoopWork();
+  }
+  _ProfileBenchmark.Tick(DeltaSeconds, FPlatformTime::Seconds() - pumpStart, _ResourceMonitor.GetTotals());
+
   if (_ProcessingTime <= 0)
     return;
   FPlatformProcess::Sleep(_ProcessingTime * .001f);
@@ -126,6 +175,12 @@ void FNEONModule::OnPreWorldInitialization(UWorld *World, const UWorld::Initiali
     return;
   }
 
+  // CEF can only be initialized once per process
+  if (_IsInitialized)
+  {
+    return;
+  }
+
   switch (World->WorldType)
   {
   case EWorldType::PIE:
@@ -186,7 +241,12 @@ void FNEONModule::OnPreWorldInitialization(UWorld *World, const UWorld::Initiali
   CefString(&settings.log_file) = TCHAR_TO_UTF8(*AbsoluteLogPath);
 
   CefString(&settings.browser_subprocess_path) = TCHAR_TO_UTF8(*AbsoluteSubprocessPath);
-  CefRefPtr<NEONApp> app(new NEONApp());
+
+  // Resolve the NEON profile for command line switches and process model
+  FNEONProfile::LoadProfile(FNEONProfile::GetSelectedProfileName(), _Profile);
+  UE_LOG(LogNEON, Log, TEXT("Using NEON profile: %s"), *_Profile.ToString());
+
+  CefRefPtr<NEONApp> app(new NEONApp(_Profile));
 
   if (!CefInitialize(mainArgs, settings, app.get(), nullptr))
   {
@@ -197,18 +257,40 @@ void FNEONModule::OnPreWorldInitialization(UWorld *World, const UWorld::Initiali
   _IsInitialized = true;
 
   UE_LOG(LogNEON, Log, TEXT("CEF Initialized"));
+
+  _ProfileBenchmark.StartFromCommandLine(_Profile.Name);
+
+  float resourceMonitorInterval = 2.0f;
+  GConfig->GetFloat(TEXT("NEON"), TEXT("ResourceMonitorInterval"), resourceMonitorInterval, GGameIni);
+  if (_ProfileBenchmark.IsRunning() && resourceMonitorInterval <= 0.0f)
+  {
+    // The benchmark reads CEF process memory from the monitor
+    resourceMonitorInterval = 1.0f;
+  }
+  _ResourceMonitor.Start(resourceMonitorInterval);
 }
 
 void FNEONModule::ShutdownModule()
 {
 
+  _ResourceMonitor.Stop();
+  _Broadcast.Reset();
+
+  if (FNEONBridgeRecorder::IsRecording())
+  {
+    FNEONBridgeRecorder::Stop();
+  }
+
   if (_IsInitialized)
   {
     CefShutdown();
   }
 
-  FPlatformProcess::FreeDllHandle(_LibecfHandle);
-  _LibecfHandle = nullptr;
+  if (_LibecfHandle)
+  {
+    FPlatformProcess::FreeDllHandle(_LibecfHandle);
+    _LibecfHandle = nullptr;
+  }
 }
 
 IMPLEMENT_MODULE(FNEONModule, NEON)
\ No newline at end of file
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONAudioComponent.cpp
+
+#include "NEONAudioComponent.h"
+
+UNEONAudioComponent::UNEONAudioComponent(const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+  bAutoActivate = false;
+  bIsUISound = true;
+  bAllowSpatialization = false;
+}
+
+void UNEONAudioComponent::SetStream(TSharedPtr<FNEONAudioStream, ESPMode::ThreadSafe> Stream)
+{
+  _Stream = Stream;
+  if (_Stream)
+  {
+    _SampleRate = _Stream->GetSampleRate();
+    _NumChannels = _Stream->GetNumChannels();
+  }
+}
+
+bool UNEONAudioComponent::Init(int32 &SampleRate)
+{
+  SampleRate = _SampleRate;
+  NumChannels = _NumChannels;
+  return true;
+}
+
+int32 UNEONAudioComponent::OnGenerateAudio(float *OutAudio, int32 NumSamples)
+{
+  // Underruns are silence, the mixer expects the full block
+  const int32 popped = _Stream ? _Stream->Pop(OutAudio, NumSamples) : 0;
+  if (popped < NumSamples)
+  {
+    FMemory::Memzero(OutAudio + popped, (NumSamples - popped) * sizeof(float));
+  }
+  return NumSamples;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONAudioStream.cpp
+
+#include "NEONAudioStream.h"
+
+#include "NEONLogging.h"
+
+// Half a second of 48kHz stereo. Anything beyond that is latency nobody wants in a UI.
+static constexpr uint32 NEONAudioBufferCapacity = 48000;
+
+FNEONAudioStream::FNEONAudioStream()
+{
+  _Buffer.SetCapacity(NEONAudioBufferCapacity);
+}
+
+void FNEONAudioStream::Start(int32 SampleRate, int32 NumChannels)
+{
+  _SourceChannels = NumChannels;
+  _SampleRate.store(SampleRate, std::memory_order_release);
+  _NumChannels.store(FMath::Clamp(NumChannels, 1, MaxChannels), std::memory_order_release);
+  _IsPlaying.store(true, std::memory_order_release);
+  _Generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void FNEONAudioStream::Push(const float **Data, int32 Frames)
+{
+  if (!Data || Frames <= 0 || _SourceChannels <= 0)
+  {
+    return;
+  }
+
+  // Front left/right of larger layouts, Chromium is asked for stereo so this is the rare case
+  const int32 channels = FMath::Min(_SourceChannels, MaxChannels);
+  _Interleaved.SetNumUninitialized(Frames * channels, EAllowShrinking::No);
+  for (int32 frame = 0; frame < Frames; ++frame)
+  {
+    for (int32 channel = 0; channel < channels; ++channel)
+    {
+      _Interleaved[frame * channels + channel] = Data[channel][frame];
+    }
+  }
+
+  const uint32 pushed = _Buffer.Push(_Interleaved.GetData(), _Interleaved.Num());
+  if (pushed < static_cast<uint32>(_Interleaved.Num()))
+  {
+    _DroppedSamples.fetch_add(_Interleaved.Num() - pushed, std::memory_order_relaxed);
+  }
+}
+
+void FNEONAudioStream::Stop()
+{
+  _IsPlaying.store(false, std::memory_order_release);
+  _Generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+int32 FNEONAudioStream::Pop(float *OutAudio, int32 NumSamples)
+{
+  return static_cast<int32>(_Buffer.Pop(OutAudio, NumSamples));
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBindingsCommandlet.cpp
+
+#include "NEONBindingsCommandlet.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+
+#include "NEONBridgeBindings.h"
+#include "NEONLogging.h"
+#include "UNEONWidget.h"
+
+namespace
+{
+  FString GetTypeScriptType(const FProperty *Property)
+  {
+    if (CastField<FBoolProperty>(Property))
+    {
+      return TEXT("boolean");
+    }
+    if (CastField<FNumericProperty>(Property))
+    {
+      return TEXT("number");
+    }
+    if (CastField<FStrProperty>(Property))
+    {
+      return TEXT("string");
+    }
+    if (const FStructProperty *structProperty = CastField<FStructProperty>(Property))
+    {
+      // The only struct the bridge understands (see NEONMessageHandler::BuildParamsBuffer)
+      return structProperty->Struct->GetFName() == TEXT("JsonObjectWrapper") ? TEXT("Record<string, unknown>") : TEXT("unknown");
+    }
+    if (const FArrayProperty *arrayProperty = CastField<FArrayProperty>(Property))
+    {
+      return GetTypeScriptType(arrayProperty->Inner) + TEXT("[]");
+    }
+    return TEXT("unknown");
+  }
+
+  // Same split as NEONMessageHandler: pure out parameters are results, everything else is sent by the page
+  bool IsResult(const FProperty *Property)
+  {
+    return Property->HasAllPropertyFlags(CPF_OutParm) && !Property->HasAnyPropertyFlags(CPF_ReferenceParm);
+  }
+
+  FString GetShape(const UFunction *Function, bool bResults)
+  {
+    TArray<FString> fields;
+    for (TFieldIterator<FProperty> propertyIt(Function); propertyIt && propertyIt->HasAnyPropertyFlags(CPF_Parm); ++propertyIt)
+    {
+      if (IsResult(*propertyIt) == bResults)
+      {
+        fields.Add(FString::Printf(TEXT("%s: %s"), *propertyIt->GetName(), *GetTypeScriptType(*propertyIt)));
+      }
+    }
+    return fields.IsEmpty() ? TEXT("{}") : TEXT("{ ") + FString::Join(fields, TEXT("; ")) + TEXT(" }");
+  }
+
+  FString GetExportName(const UClass *WidgetClass)
+  {
+    FString name = WidgetClass->GetName();
+    name.RemoveFromEnd(TEXT("_C"));
+    return name;
+  }
+
+  void LoadWidgetBlueprints()
+  {
+    IAssetRegistry &assetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    assetRegistry.SearchAllAssets(true);
+
+    TArray<FAssetData> blueprints;
+    assetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), blueprints, true);
+    for (const FAssetData &blueprint : blueprints)
+    {
+      // Only load blueprints whose native parent is a NEON widget
+      FString nativeParentPath;
+      if (!blueprint.GetTagValue(FBlueprintTags::NativeParentClassPath, nativeParentPath))
+      {
+        continue;
+      }
+      UClass *nativeParent = FSoftClassPath(FPackageName::ExportTextPathToObjectPath(nativeParentPath)).ResolveClass();
+      if (nativeParent && nativeParent->IsChildOf(UNEONWidget::StaticClass()))
+      {
+        blueprint.GetAsset();
+      }
+    }
+  }
+}
+
+UNEONBindingsCommandlet::UNEONBindingsCommandlet()
+{
+  IsClient = false;
+  IsServer = false;
+  IsEditor = true;
+  LogToConsole = true;
+}
+
+int32 UNEONBindingsCommandlet::Main(const FString &Params)
+{
+  FString outputDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("NEON"), TEXT("bindings"));
+  FParse::Value(*Params, TEXT("Output="), outputDir);
+
+  LoadWidgetBlueprints();
+
+  TArray<UClass *> widgetClasses;
+  for (TObjectIterator<UClass> classIt; classIt; ++classIt)
+  {
+    UClass *widgetClass = *classIt;
+    if (widgetClass == UNEONWidget::StaticClass() || !widgetClass->IsChildOf(UNEONWidget::StaticClass()) ||
+        widgetClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Transient | CLASS_NewerVersionExists | CLASS_Deprecated) ||
+        widgetClass->GetName().StartsWith(TEXT("SKEL_")) || widgetClass->GetName().StartsWith(TEXT("REINST_")))
+    {
+      continue;
+    }
+    widgetClasses.Add(widgetClass);
+  }
+  widgetClasses.Sort([](const UClass &A, const UClass &B)
+                     { return A.GetName() < B.GetName(); });
+
+  FString js = TEXT("// Generated by -run=NEONBindings. Do not edit.\nimport NEON from 'neon-ue-web';\n");
+  FString dts = TEXT("// Generated by -run=NEONBindings. Do not edit.\n");
+
+  int32 exitCode = 0;
+  int32 delegateCount = 0;
+  for (const UClass *widgetClass : widgetClasses)
+  {
+    TArray<UFunction *> delegates;
+    FNEONBridgeBindings::GetDelegates(widgetClass, delegates);
+
+    TMap<uint32, UFunction *> table;
+    if (!FNEONBridgeBindings::BuildDispatchTable(widgetClass, table))
+    {
+      exitCode = 1;
+    }
+    if (delegates.IsEmpty())
+    {
+      continue;
+    }
+
+    const FString exportName = GetExportName(widgetClass);
+    js += FString::Printf(TEXT("\n// %s\nexport const %s = {\n"), *widgetClass->GetPathName(), *exportName);
+    dts += FString::Printf(TEXT("\n/** %s */\nexport declare const %s: {\n"), *widgetClass->GetPathName(), *exportName);
+
+    for (const UFunction *function : delegates)
+    {
+      const FString name = function->GetName();
+      const uint32 id = FNEONBridgeBindings::GetDelegateId(name);
+      const bool isFunction = FNEONBridgeBindings::IsFunction(function);
+
+      js += FString::Printf(TEXT("  %s: (parameters) => NEON.%s(%u, parameters),\n"),
+                            *name, isFunction ? TEXT("invokeUnrealFunctionById") : TEXT("invokeUnrealEventById"), id);
+      dts += FString::Printf(TEXT("  %s(parameters: %s): Promise<%s>;\n"),
+                             *name, *GetShape(function, false), isFunction ? *GetShape(function, true) : TEXT("void"));
+      delegateCount++;
+    }
+
+    js += TEXT("};\n");
+    dts += TEXT("};\n");
+  }
+
+  const FString jsPath = FPaths::Combine(outputDir, TEXT("neon-bindings.js"));
+  const FString dtsPath = FPaths::Combine(outputDir, TEXT("neon-bindings.d.ts"));
+  if (!FFileHelper::SaveStringToFile(js, *jsPath) || !FFileHelper::SaveStringToFile(dts, *dtsPath))
+  {
+    UE_LOG(LogNEON, Error, TEXT("Failed to write NEON bindings to %s"), *outputDir);
+    return 2;
+  }
+
+  UE_LOG(LogNEON, Display, TEXT("NEON bindings for %d delegates of %d widget classes written to %s"), delegateCount, widgetClasses.Num(), *outputDir);
+  return exitCode;
+}
@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeBenchmarkCommandlet.cpp
+
+#include "NEONBridgeBenchmarkCommandlet.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+#include "NEONBridgeBenchmarkWidget.h"
+#include "NEONLogging.h"
+#include "NEONMessageHandler.h"
+
+namespace
+{
+  // Stands in for the CEF message router callback
+  class NEONBenchmarkResponder : public NEONBridgeResponder
+  {
+  public:
+    void Success(const FString &Response) override { Successes++; }
+    void Failure(int32 ErrorCode, const FString &ErrorMessage) override
+    {
+      if (Failures++ == 0)
+      {
+        UE_LOG(LogNEON, Error, TEXT("Benchmark query failed (%d): %s"), ErrorCode, *ErrorMessage);
+      }
+    }
+
+    int64 Successes = 0;
+    int64 Failures = 0;
+  };
+
+  struct FNEONBenchmarkPayload
+  {
+    FString Name;
+    FString Request;
+  };
+
+  struct FNEONBenchmarkResult
+  {
+    FString Name;
+    int32 Bytes = 0;
+    double QueriesPerSecond = 0.0;
+    double AllocationsPerQuery = -1.0;
+    double P50Us = 0.0;
+    double P99Us = 0.0;
+    int64 Failures = 0;
+  };
+
+  FString MakeRequest(const TCHAR *Type, const TCHAR *Delegate, const FString &Parameters)
+  {
+    return FString::Printf(TEXT("{\"type\":\"%s\",\"delegate\":\"%s\",\"parameters\":%s}"), Type, Delegate, *Parameters);
+  }
+
+  FString MakeNumberArray(int32 Count)
+  {
+    TArray<FString> values;
+    values.Reserve(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+      values.Add(FString::SanitizeFloat(i * 0.5f));
+    }
+    return TEXT("[") + FString::Join(values, TEXT(",")) + TEXT("]");
+  }
+
+  FString MakeStringArray(int32 Count)
+  {
+    TArray<FString> values;
+    values.Reserve(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+      values.Add(FString::Printf(TEXT("\"item_%d\""), i));
+    }
+    return TEXT("[") + FString::Join(values, TEXT(",")) + TEXT("]");
+  }
+
+  FString MakeNestedObject(int32 Depth, int32 Width)
+  {
+    if (Depth == 0)
+    {
+      return TEXT("{\"leaf\":true,\"value\":42.5,\"label\":\"leaf\"}");
+    }
+    TArray<FString> fields;
+    for (int32 i = 0; i < Width; ++i)
+    {
+      fields.Add(FString::Printf(TEXT("\"child_%d\":%s"), i, *MakeNestedObject(Depth - 1, Width)));
+    }
+    return TEXT("{") + FString::Join(fields, TEXT(",")) + TEXT("}");
+  }
+
+  TArray<FNEONBenchmarkPayload> MakePayloads()
+  {
+    return {
+        {TEXT("Event"), MakeRequest(TEXT("event"), TEXT("OnInvoke_BenchEvent"), TEXT("{\"Value\":1}"))},
+        {TEXT("Scalars"), MakeRequest(TEXT("function"), TEXT("Invoke_BenchScalars"), TEXT("{\"Flag\":true,\"Count\":3,\"Scale\":1.5,\"Label\":\"hello\"}"))},
+        {TEXT("Array100"), MakeRequest(TEXT("function"), TEXT("Invoke_BenchArray"), FString::Printf(TEXT("{\"Values\":%s}"), *MakeNumberArray(100)))},
+        {TEXT("Array10000"), MakeRequest(TEXT("function"), TEXT("Invoke_BenchArray"), FString::Printf(TEXT("{\"Values\":%s}"), *MakeNumberArray(10000)))},
+        {TEXT("Strings1000"), MakeRequest(TEXT("function"), TEXT("Invoke_BenchStrings"), FString::Printf(TEXT("{\"Values\":%s}"), *MakeStringArray(1000)))},
+        {TEXT("Nested3x4"), MakeRequest(TEXT("function"), TEXT("Invoke_BenchNested"), FString::Printf(TEXT("{\"Data\":%s}"), *MakeNestedObject(3, 4)))},
+    };
+  }
+
+  uint64 GetAllocationCount()
+  {
+#if STATS
+    return FMalloc::TotalMallocCalls.load() + FMalloc::TotalReallocCalls.load();
+#else
+    return 0;
+#endif
+  }
+
+  FNEONBenchmarkResult RunPayload(NEONMessageHandler &Handler, const FNEONBenchmarkPayload &Payload, int32 Iterations)
+  {
+    FNEONBenchmarkResult result;
+    result.Name = Payload.Name;
+    result.Bytes = Payload.Request.Len();
+
+    NEONBenchmarkResponder responder;
+
+    // Warm caches, FName lookups and allocator bins
+    const int32 warmup = FMath::Max(Iterations / 10, 10);
+    for (int32 i = 0; i < warmup; ++i)
+    {
+      Handler.HandleQuery(Payload.Request, responder);
+    }
+
+    TArray<double> samples;
+    samples.SetNumUninitialized(Iterations);
+
+    const uint64 allocationsStart = GetAllocationCount();
+    const double start = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Iterations; ++i)
+    {
+      const uint64 queryStart = FPlatformTime::Cycles64();
+      Handler.HandleQuery(Payload.Request, responder);
+      samples[i] = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - queryStart) * 1000000.0;
+    }
+    const double elapsed = FPlatformTime::Seconds() - start;
+    const uint64 allocations = GetAllocationCount() - allocationsStart;
+
+    samples.Sort();
+    result.QueriesPerSecond = elapsed > 0.0 ? Iterations / elapsed : 0.0;
+#if STATS
+    // Includes the samples array growth, which is none: it is sized up front
+    result.AllocationsPerQuery = static_cast<double>(allocations) / Iterations;
+#endif
+    result.P50Us = samples[Iterations / 2];
+    result.P99Us = samples[FMath::Min(Iterations - 1, FMath::CeilToInt(Iterations * 0.99) - 1)];
+    result.Failures = responder.Failures;
+    return result;
+  }
+
+  bool LoadBaseline(const FString &Path, TMap<FString, FNEONBenchmarkResult> &OutBaseline)
+  {
+    TArray<FString> lines;
+    if (!FFileHelper::LoadFileToStringArray(lines, *Path))
+    {
+      return false;
+    }
+    for (int32 i = 1; i < lines.Num(); ++i)
+    {
+      TArray<FString> columns;
+      lines[i].ParseIntoArray(columns, TEXT(","));
+      if (columns.Num() < 6)
+      {
+        continue;
+      }
+      FNEONBenchmarkResult result;
+      result.Name = columns[0];
+      result.QueriesPerSecond = FCString::Atod(*columns[2]);
+      result.P99Us = FCString::Atod(*columns[5]);
+      OutBaseline.Add(result.Name, result);
+    }
+    return true;
+  }
+}
+
+UNEONBridgeBenchmarkCommandlet::UNEONBridgeBenchmarkCommandlet()
+{
+  IsClient = false;
+  IsServer = false;
+  IsEditor = false;
+  LogToConsole = true;
+}
+
+int32 UNEONBridgeBenchmarkCommandlet::Main(const FString &Params)
+{
+  int32 iterations = 20000;
+  FParse::Value(*Params, TEXT("Iterations="), iterations);
+  iterations = FMath::Max(iterations, 100);
+
+  float threshold = 0.15f;
+  FParse::Value(*Params, TEXT("Threshold="), threshold);
+
+  FString outputPath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("NEON"), TEXT("BridgeBenchmark.csv"));
+  FParse::Value(*Params, TEXT("Output="), outputPath);
+
+  FString baselinePath;
+  FParse::Value(*Params, TEXT("Baseline="), baselinePath);
+
+  // The bridge logs every parameter at Verbose, that must not end up in the measurement
+  LogNEONMessageHandler.SetVerbosity(ELogVerbosity::Warning);
+
+  UNEONBridgeBenchmarkWidget *widget = NewObject<UNEONBridgeBenchmarkWidget>(GetTransientPackage());
+  widget->AddToRoot();
+  NEONMessageHandler handler(widget);
+
+  TArray<FNEONBenchmarkResult> results;
+  FString csv = TEXT("Payload,Bytes,QueriesPerSecond,AllocationsPerQuery,P50Us,P99Us,Failures\n");
+  for (const FNEONBenchmarkPayload &payload : MakePayloads())
+  {
+    // Large payloads are orders of magnitude slower, keep the total runtime bounded
+    const int32 payloadIterations = payload.Request.Len() > 10000 ? FMath::Max(iterations / 20, 100) : iterations;
+    FNEONBenchmarkResult result = RunPayload(handler, payload, payloadIterations);
+    results.Add(result);
+
+    UE_LOG(LogNEON, Display, TEXT("%-12s %7d bytes  %10.0f q/s  %6.1f allocs/q  p50 %8.2fus  p99 %8.2fus  %lld failures"),
+           *result.Name, result.Bytes, result.QueriesPerSecond, result.AllocationsPerQuery, result.P50Us, result.P99Us, result.Failures);
+    csv += FString::Printf(TEXT("%s,%d,%.1f,%.2f,%.3f,%.3f,%lld\n"),
+                           *result.Name, result.Bytes, result.QueriesPerSecond, result.AllocationsPerQuery, result.P50Us, result.P99Us, result.Failures);
+  }
+
+  widget->RemoveFromRoot();
+
+  if (!FFileHelper::SaveStringToFile(csv, *outputPath))
+  {
+    UE_LOG(LogNEON, Error, TEXT("Failed to write %s"), *outputPath);
+  }
+  else
+  {
+    UE_LOG(LogNEON, Display, TEXT("NEON bridge benchmark written to %s"), *outputPath);
+  }
+
+  int32 exitCode = 0;
+  for (const FNEONBenchmarkResult &result : results)
+  {
+    if (result.Failures > 0)
+    {
+      UE_LOG(LogNEON, Error, TEXT("%s: %lld queries failed."), *result.Name, result.Failures);
+      exitCode = 1;
+    }
+  }
+
+  if (!baselinePath.IsEmpty())
+  {
+    TMap<FString, FNEONBenchmarkResult> baseline;
+    if (!LoadBaseline(baselinePath, baseline))
+    {
+      UE_LOG(LogNEON, Error, TEXT("Failed to read baseline %s"), *baselinePath);
+      return 2;
+    }
+
+    for (const FNEONBenchmarkResult &result : results)
+    {
+      const FNEONBenchmarkResult *base = baseline.Find(result.Name);
+      if (!base)
+      {
+        continue;
+      }
+      const bool throughputRegressed = base->QueriesPerSecond > 0.0 && result.QueriesPerSecond < base->QueriesPerSecond * (1.0 - threshold);
+      const bool latencyRegressed = base->P99Us > 0.0 && result.P99Us > base->P99Us * (1.0 + threshold);
+      if (throughputRegressed || latencyRegressed)
+      {
+        UE_LOG(LogNEON, Error, TEXT("%s regressed: %.0f q/s (baseline %.0f), p99 %.2fus (baseline %.2fus)"),
+               *result.Name, result.QueriesPerSecond, base->QueriesPerSecond, result.P99Us, base->P99Us);
+        exitCode = 1;
+      }
+    }
+  }
+
+  return exitCode;
+}
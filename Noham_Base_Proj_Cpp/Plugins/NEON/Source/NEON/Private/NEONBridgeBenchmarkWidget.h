@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeBenchmarkWidget.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonObjectWrapper.h"
+
+#include "UNEONWidget.h"
+
+#include "NEONBridgeBenchmarkWidget.generated.h"
+
+/**
+ * Bridge targets for UNEONBridgeBenchmarkCommandlet. Never constructed as a real widget, the message handler only
+ * needs FindFunction and ProcessEvent. Each delegate does a minimal amount of work so the benchmark measures the
+ * marshalling, not the payload.
+ */
+UCLASS(Transient, NotBlueprintable, NotBlueprintType)
+class UNEONBridgeBenchmarkWidget : public UNEONWidget
+{
+  GENERATED_BODY()
+
+public:
+  UNEONBridgeBenchmarkWidget(const FObjectInitializer &ObjectInitializer) : Super(ObjectInitializer) {}
+
+  UFUNCTION()
+  void OnInvoke_BenchEvent(int32 Value) { _Counter += Value; }
+
+  UFUNCTION()
+  void Invoke_BenchScalars(bool Flag, int32 Count, float Scale, FString Label, int32 &Result)
+  {
+    Result = Flag ? Count + Label.Len() : static_cast<int32>(Scale);
+  }
+
+  UFUNCTION()
+  void Invoke_BenchArray(const TArray<float> &Values, float &Sum)
+  {
+    Sum = 0.0f;
+    for (float value : Values)
+      Sum += value;
+  }
+
+  UFUNCTION()
+  void Invoke_BenchStrings(const TArray<FString> &Values, int32 &Count) { Count = Values.Num(); }
+
+  UFUNCTION()
+  void Invoke_BenchNested(const FJsonObjectWrapper &Data, FJsonObjectWrapper &Echo) { Echo = Data; }
+
+private:
+  int64 _Counter = 0;
+};
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeBindings.cpp
+
+#include "NEONBridgeBindings.h"
+#include "Misc/Crc.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+#include "NEONLogging.h"
+
+const TCHAR *FNEONBridgeBindings::FunctionPrefix = TEXT("Invoke_");
+const TCHAR *FNEONBridgeBindings::EventPrefix = TEXT("OnInvoke_");
+
+uint32 FNEONBridgeBindings::GetDelegateId(const FString &DelegateName)
+{
+  return FCrc::StrCrc32(*DelegateName);
+}
+
+bool FNEONBridgeBindings::IsFunction(const UFunction *Function)
+{
+  return Function && Function->GetName().StartsWith(FunctionPrefix, ESearchCase::CaseSensitive);
+}
+
+bool FNEONBridgeBindings::IsEvent(const UFunction *Function)
+{
+  return Function && Function->GetName().StartsWith(EventPrefix, ESearchCase::CaseSensitive);
+}
+
+void FNEONBridgeBindings::GetDelegates(const UClass *WidgetClass, TArray<UFunction *> &OutDelegates)
+{
+  OutDelegates.Reset();
+  if (!WidgetClass)
+  {
+    return;
+  }
+
+  TSet<FName> seen;
+  for (TFieldIterator<UFunction> functionIt(WidgetClass, EFieldIteratorFlags::IncludeSuper); functionIt; ++functionIt)
+  {
+    UFunction *function = *functionIt;
+    // Overrides come first, skip the parent's version
+    if ((IsFunction(function) || IsEvent(function)) && !seen.Contains(function->GetFName()))
+    {
+      seen.Add(function->GetFName());
+      OutDelegates.Add(function);
+    }
+  }
+
+  OutDelegates.Sort([](const UFunction &A, const UFunction &B)
+                    { return A.GetName() < B.GetName(); });
+}
+
+bool FNEONBridgeBindings::BuildDispatchTable(const UClass *WidgetClass, TMap<uint32, UFunction *> &OutTable)
+{
+  TArray<UFunction *> delegates;
+  GetDelegates(WidgetClass, delegates);
+
+  OutTable.Reset();
+  bool unique = true;
+  for (UFunction *function : delegates)
+  {
+    const uint32 id = GetDelegateId(function->GetName());
+    if (UFunction **existing = OutTable.Find(id))
+    {
+      UE_LOG(LogNEONMessageHandler, Error, TEXT("Bridge delegates %s and %s of %s share the ID %u. Rename one of them."),
+             *(*existing)->GetName(), *function->GetName(), *WidgetClass->GetName(), id);
+      unique = false;
+      continue;
+    }
+    OutTable.Add(id, function);
+  }
+  return unique;
+}
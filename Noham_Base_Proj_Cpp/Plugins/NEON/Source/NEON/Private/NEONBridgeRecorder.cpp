@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeRecorder.cpp
+
+#include "NEONBridgeRecorder.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+
+#include "NEONLogging.h"
+#include "UNEONWidget.h"
+
+static FAutoConsoleCommand GNEONBridgeRecordStartCommand(
+    TEXT("neon.bridge.record.start"),
+    TEXT("Record all NEON bridge traffic for replay with -run=NEONBridgeReplay. Usage: neon.bridge.record.start [path]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args)
+        {
+          FNEONBridgeRecorder::Start(Args.Num() > 0 ? Args[0] : FString());
+        }));
+
+static FAutoConsoleCommand GNEONBridgeRecordStopCommand(
+    TEXT("neon.bridge.record.stop"),
+    TEXT("Stop recording NEON bridge traffic."),
+    FConsoleCommandDelegate::CreateLambda(
+        []()
+        {
+          FNEONBridgeRecorder::Stop();
+        }));
+
+TUniquePtr<FArchive> FNEONBridgeRecorder::_Writer;
+FString FNEONBridgeRecorder::_FilePath;
+TMap<FObjectKey, uint32> FNEONBridgeRecorder::_WidgetIndices;
+uint64 FNEONBridgeRecorder::_StartCycles = 0;
+uint64 FNEONBridgeRecorder::_LastMicroseconds = 0;
+int64 FNEONBridgeRecorder::_RecordCount = 0;
+
+namespace
+{
+  // "NBRL"
+  constexpr uint32 NEONBridgeLogMagic = 0x4C52424E;
+  constexpr uint32 NEONBridgeLogVersion = 2;
+
+  // Length prefixed UTF-8, bridge traffic is mostly ASCII JSON
+  void WriteString(FArchive &Ar, const FString &Value)
+  {
+    FTCHARToUTF8 utf8(*Value);
+    uint32 length = utf8.Length();
+    Ar.SerializeIntPacked(length);
+    Ar.Serialize(const_cast<ANSICHAR *>(utf8.Get()), length);
+  }
+
+  bool ReadString(FArchive &Ar, FString &OutValue)
+  {
+    uint32 length = 0;
+    Ar.SerializeIntPacked(length);
+    if (Ar.IsError() || length > Ar.TotalSize() - Ar.Tell())
+    {
+      return false;
+    }
+    TArray<ANSICHAR> buffer;
+    buffer.SetNumUninitialized(length);
+    Ar.Serialize(buffer.GetData(), length);
+    OutValue = FString(FUTF8ToTCHAR(buffer.GetData(), length));
+    return !Ar.IsError();
+  }
+}
+
+bool FNEONBridgeRecorder::Start(const FString &FilePath)
+{
+  if (IsRecording())
+  {
+    UE_LOG(LogNEON, Warning, TEXT("NEON bridge recording is already running (%s)."), *_FilePath);
+    return false;
+  }
+
+  _FilePath = FilePath.IsEmpty()
+                  ? FPaths::Combine(FPaths::ProfilingDir(), TEXT("NEON"), FDateTime::Now().ToString() + TEXT(".neonbridge"))
+                  : FilePath;
+
+  _Writer.Reset(IFileManager::Get().CreateFileWriter(*_FilePath));
+  if (!_Writer)
+  {
+    UE_LOG(LogNEON, Error, TEXT("Failed to open %s for NEON bridge recording."), *_FilePath);
+    return false;
+  }
+
+  uint32 magic = NEONBridgeLogMagic;
+  uint32 version = NEONBridgeLogVersion;
+  *_Writer << magic << version;
+
+  _WidgetIndices.Reset();
+  _StartCycles = FPlatformTime::Cycles64();
+  _LastMicroseconds = 0;
+  _RecordCount = 0;
+
+  UE_LOG(LogNEON, Log, TEXT("NEON bridge recording started: %s"), *_FilePath);
+  return true;
+}
+
+bool FNEONBridgeRecorder::Stop()
+{
+  if (!IsRecording())
+  {
+    UE_LOG(LogNEON, Warning, TEXT("NEON bridge recording is not running."));
+    return false;
+  }
+
+  const int64 bytes = _Writer->Tell();
+  _Writer->Close();
+  _Writer.Reset();
+  _WidgetIndices.Reset();
+
+  UE_LOG(LogNEON, Log, TEXT("NEON bridge recording stopped: %lld records, %lld bytes written to %s"), _RecordCount, bytes, *_FilePath);
+  return true;
+}
+
+uint32 FNEONBridgeRecorder::GetWidgetIndex(const UNEONWidget *Widget)
+{
+  if (const uint32 *index = _WidgetIndices.Find(FObjectKey(Widget)))
+  {
+    return *index;
+  }
+
+  const uint32 index = _WidgetIndices.Num();
+  _WidgetIndices.Add(FObjectKey(Widget), index);
+
+  WriteHeader(ERecordType::Widget, index);
+  WriteString(*_Writer, Widget->GetClass()->GetPathName());
+  WriteString(*_Writer, Widget->GetName());
+  return index;
+}
+
+void FNEONBridgeRecorder::WriteHeader(ERecordType Type, uint32 WidgetIndex)
+{
+  const uint64 microseconds = static_cast<uint64>(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - _StartCycles) * 1000000.0);
+  uint32 delta = static_cast<uint32>(FMath::Min<uint64>(microseconds - _LastMicroseconds, MAX_uint32));
+  _LastMicroseconds += delta;
+
+  uint8 type = static_cast<uint8>(Type);
+  *_Writer << type;
+  _Writer->SerializeIntPacked(delta);
+  _Writer->SerializeIntPacked(WidgetIndex);
+  _RecordCount++;
+}
+
+void FNEONBridgeRecorder::RecordQuery(const UNEONWidget *Widget, const FString &Request)
+{
+  if (!IsRecording() || !Widget)
+  {
+    return;
+  }
+
+  const uint32 widgetIndex = GetWidgetIndex(Widget);
+  WriteHeader(ERecordType::Query, widgetIndex);
+  WriteString(*_Writer, Request);
+}
+
+void FNEONBridgeRecorder::RecordInvocation(const UNEONWidget *Widget, const FString &Method, EInvocationKind Kind, const FString &Value)
+{
+  if (!IsRecording() || !Widget)
+  {
+    return;
+  }
+
+  const uint32 widgetIndex = GetWidgetIndex(Widget);
+  WriteHeader(ERecordType::Invocation, widgetIndex);
+  uint8 kind = static_cast<uint8>(Kind);
+  WriteString(*_Writer, Method);
+  *_Writer << kind;
+  WriteString(*_Writer, Value);
+}
+
+bool FNEONBridgeRecorder::Load(const FString &FilePath, FLog &OutLog)
+{
+  TUniquePtr<FArchive> reader(IFileManager::Get().CreateFileReader(*FilePath));
+  if (!reader)
+  {
+    UE_LOG(LogNEON, Error, TEXT("Failed to open NEON bridge log %s"), *FilePath);
+    return false;
+  }
+
+  uint32 magic = 0;
+  uint32 version = 0;
+  *reader << magic << version;
+  if (magic != NEONBridgeLogMagic || version != NEONBridgeLogVersion)
+  {
+    UE_LOG(LogNEON, Error, TEXT("%s is not a NEON bridge log of version %u (found %u), record it again."), *FilePath, NEONBridgeLogVersion, version);
+    return false;
+  }
+
+  uint64 microseconds = 0;
+  while (reader->Tell() < reader->TotalSize())
+  {
+    uint8 type = 0;
+    uint32 delta = 0;
+    uint32 widgetIndex = 0;
+    *reader << type;
+    reader->SerializeIntPacked(delta);
+    reader->SerializeIntPacked(widgetIndex);
+    microseconds += delta;
+
+    bool valid = !reader->IsError();
+    if (static_cast<ERecordType>(type) == ERecordType::Widget)
+    {
+      FWidget widget;
+      valid = valid && widgetIndex == static_cast<uint32>(OutLog.Widgets.Num());
+      valid = valid && ReadString(*reader, widget.ClassPath) && ReadString(*reader, widget.Name);
+      if (valid)
+      {
+        OutLog.Widgets.Add(MoveTemp(widget));
+      }
+    }
+    else if (static_cast<ERecordType>(type) == ERecordType::Query || static_cast<ERecordType>(type) == ERecordType::Invocation)
+    {
+      FRecord record;
+      record.Type = static_cast<ERecordType>(type);
+      record.Time = microseconds / 1000000.0;
+      record.WidgetIndex = widgetIndex;
+      valid = valid && OutLog.Widgets.IsValidIndex(record.WidgetIndex);
+      if (record.Type == ERecordType::Invocation)
+      {
+        uint8 kind = 0;
+        valid = valid && ReadString(*reader, record.Method);
+        *reader << kind;
+        valid = valid && !reader->IsError() && kind <= static_cast<uint8>(EInvocationKind::String);
+        record.Kind = static_cast<EInvocationKind>(kind);
+      }
+      valid = valid && ReadString(*reader, record.Payload);
+      if (valid)
+      {
+        OutLog.Records.Add(MoveTemp(record));
+      }
+    }
+    else
+    {
+      valid = false;
+    }
+
+    if (!valid)
+    {
+      // A session that crashed leaves a truncated last record, keep everything before it
+      UE_LOG(LogNEON, Warning, TEXT("NEON bridge log %s is corrupt or truncated at offset %lld."), *FilePath, reader->Tell());
+      break;
+    }
+  }
+
+  return true;
+}
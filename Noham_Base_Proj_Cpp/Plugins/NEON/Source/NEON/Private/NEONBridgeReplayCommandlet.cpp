@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeReplayCommandlet.cpp
+
+#include "NEONBridgeReplayCommandlet.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "JsonObjectWrapper.h"
+#include "UObject/Package.h"
+
+#include "NEONBridgeRecorder.h"
+#include "NEONLogging.h"
+#include "NEONMessageHandler.h"
+#include "UNEONWidget.h"
+
+namespace
+{
+  class NEONReplayResponder : public NEONBridgeResponder
+  {
+  public:
+    void Success(const FString &Response) override { Successes++; }
+    void Failure(int32 ErrorCode, const FString &ErrorMessage) override { Failures++; }
+
+    int64 Successes = 0;
+    int64 Failures = 0;
+  };
+
+  struct FNEONReplayWidget
+  {
+    UNEONWidget *Widget = nullptr;
+    TUniquePtr<NEONMessageHandler> Handler;
+  };
+
+  double Percentile(const TArray<double> &SortedTimes, double Fraction)
+  {
+    const int32 count = SortedTimes.Num();
+    return count > 0 ? SortedTimes[FMath::Clamp(FMath::CeilToInt(count * Fraction) - 1, 0, count - 1)] : 0.0;
+  }
+}
+
+UNEONBridgeReplayCommandlet::UNEONBridgeReplayCommandlet()
+{
+  IsClient = false;
+  IsServer = false;
+  IsEditor = false;
+  LogToConsole = true;
+}
+
+int32 UNEONBridgeReplayCommandlet::Main(const FString &Params)
+{
+  FString logPath;
+  if (!FParse::Value(*Params, TEXT("Log="), logPath))
+  {
+    UE_LOG(LogNEON, Error, TEXT("Usage: -run=NEONBridgeReplay -Log=<file.neonbridge> [-MaxSpeed] [-Loops=1] [-Output=<csv>]"));
+    return 2;
+  }
+
+  const bool maxSpeed = FParse::Param(*Params, TEXT("MaxSpeed"));
+
+  int32 loops = 1;
+  FParse::Value(*Params, TEXT("Loops="), loops);
+  loops = FMath::Max(loops, 1);
+
+  FString outputPath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("NEON"), TEXT("BridgeReplay.csv"));
+  FParse::Value(*Params, TEXT("Output="), outputPath);
+
+  FNEONBridgeRecorder::FLog log;
+  if (!FNEONBridgeRecorder::Load(logPath, log))
+  {
+    return 2;
+  }
+  if (log.Records.IsEmpty())
+  {
+    UE_LOG(LogNEON, Warning, TEXT("%s contains no bridge traffic."), *logPath);
+    return 0;
+  }
+
+  // The bridge logs every parameter at Verbose, that must not end up in the measurement
+  LogNEONMessageHandler.SetVerbosity(ELogVerbosity::Warning);
+
+  TArray<FNEONReplayWidget> widgets;
+  for (const FNEONBridgeRecorder::FWidget &recorded : log.Widgets)
+  {
+    UClass *widgetClass = StaticLoadClass(UNEONWidget::StaticClass(), nullptr, *recorded.ClassPath);
+    if (!widgetClass)
+    {
+      UE_LOG(LogNEON, Warning, TEXT("Widget class %s of %s not found, replaying into UNEONWidget."), *recorded.ClassPath, *recorded.Name);
+      widgetClass = UNEONWidget::StaticClass();
+    }
+
+    FNEONReplayWidget &replayWidget = widgets.AddDefaulted_GetRef();
+    replayWidget.Widget = NewObject<UNEONWidget>(GetTransientPackage(), widgetClass);
+    replayWidget.Widget->AddToRoot();
+    // No browser is ever created, invocations stop after marshalling
+    replayWidget.Widget->SetHeadless();
+    replayWidget.Handler = MakeUnique<NEONMessageHandler>(replayWidget.Widget);
+  }
+
+  NEONReplayResponder responder;
+  TArray<double> queryTimes;
+  TArray<double> invocationTimes;
+  double queryBytes = 0.0;
+
+  // JSON parameters are parsed once up front, the game passes an already built object to InvokeWeb as well
+  TArray<FJsonObjectWrapper> jsonParameters;
+  jsonParameters.SetNum(log.Records.Num());
+  for (int32 i = 0; i < log.Records.Num(); ++i)
+  {
+    const FNEONBridgeRecorder::FRecord &record = log.Records[i];
+    if (record.Type == FNEONBridgeRecorder::ERecordType::Invocation && record.Kind == FNEONBridgeRecorder::EInvocationKind::Json &&
+        !jsonParameters[i].JsonObjectFromString(record.Payload))
+    {
+      UE_LOG(LogNEON, Warning, TEXT("Invocation %s has an unparsable JSON parameter, replaying it empty."), *record.Method);
+    }
+  }
+
+  const double start = FPlatformTime::Seconds();
+  for (int32 loop = 0; loop < loops; ++loop)
+  {
+    const double loopStart = FPlatformTime::Seconds();
+    for (int32 i = 0; i < log.Records.Num(); ++i)
+    {
+      const FNEONBridgeRecorder::FRecord &record = log.Records[i];
+      if (!maxSpeed)
+      {
+        const double wait = record.Time - (FPlatformTime::Seconds() - loopStart);
+        if (wait > 0.0)
+        {
+          FPlatformProcess::Sleep(static_cast<float>(wait));
+        }
+      }
+
+      FNEONReplayWidget &target = widgets[record.WidgetIndex];
+      if (record.Type == FNEONBridgeRecorder::ERecordType::Query)
+      {
+        const uint64 queryStart = FPlatformTime::Cycles64();
+        target.Handler->HandleQuery(record.Payload, responder);
+        queryTimes.Add(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - queryStart) * 1000000.0);
+        queryBytes += record.Payload.Len();
+      }
+      else
+      {
+        const uint64 invocationStart = FPlatformTime::Cycles64();
+        switch (record.Kind)
+        {
+        case FNEONBridgeRecorder::EInvocationKind::NoParam:
+          target.Widget->InvokeWebNoParam(record.Method);
+          break;
+        case FNEONBridgeRecorder::EInvocationKind::Json:
+          target.Widget->InvokeWeb(record.Method, jsonParameters[i]);
+          break;
+        case FNEONBridgeRecorder::EInvocationKind::Boolean:
+          target.Widget->InvokeWebBoolean(record.Method, record.Payload.ToBool());
+          break;
+        case FNEONBridgeRecorder::EInvocationKind::Integer:
+          target.Widget->InvokeWebInteger(record.Method, FCString::Atoi(*record.Payload));
+          break;
+        case FNEONBridgeRecorder::EInvocationKind::Float:
+          target.Widget->InvokeWebFloat(record.Method, FCString::Atof(*record.Payload));
+          break;
+        case FNEONBridgeRecorder::EInvocationKind::String:
+          target.Widget->InvokeWebString(record.Method, record.Payload);
+          break;
+        }
+        invocationTimes.Add(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - invocationStart) * 1000000.0);
+      }
+    }
+  }
+  const double elapsed = FPlatformTime::Seconds() - start;
+
+  for (FNEONReplayWidget &replayWidget : widgets)
+  {
+    replayWidget.Handler.Reset();
+    replayWidget.Widget->RemoveFromRoot();
+  }
+
+  double queryTotal = 0.0;
+  for (double time : queryTimes)
+  {
+    queryTotal += time;
+  }
+  queryTimes.Sort();
+  invocationTimes.Sort();
+  const int32 queries = queryTimes.Num();
+  const int32 invocations = invocationTimes.Num();
+  const double p50 = Percentile(queryTimes, 0.5);
+  const double p99 = Percentile(queryTimes, 0.99);
+  const double invocationP50 = Percentile(invocationTimes, 0.5);
+  const double invocationP99 = Percentile(invocationTimes, 0.99);
+  // Throughput of the handler itself, independent of the replay speed
+  const double queriesPerSecond = queryTotal > 0.0 ? queries / (queryTotal / 1000000.0) : 0.0;
+
+  UE_LOG(LogNEON, Display, TEXT("NEON bridge replay of %s (%s, %d loops): %d queries, %d invocations in %.2fs"),
+         *FPaths::GetCleanFilename(logPath), maxSpeed ? TEXT("max speed") : TEXT("original speed"), loops, queries, invocations, elapsed);
+  UE_LOG(LogNEON, Display, TEXT("  %.0f q/s, p50 %.2fus, p99 %.2fus, %.1f bytes/query, %lld failures"),
+         queriesPerSecond, p50, p99, queries > 0 ? queryBytes / queries : 0.0, responder.Failures);
+  UE_LOG(LogNEON, Display, TEXT("  invocations p50 %.2fus, p99 %.2fus"), invocationP50, invocationP99);
+
+  if (!FPaths::FileExists(outputPath))
+  {
+    FFileHelper::SaveStringToFile(TEXT("Timestamp,Log,MaxSpeed,Loops,Queries,Invocations,Seconds,QueriesPerSecond,P50Us,P99Us,Failures,InvocationP50Us,InvocationP99Us\n"), *outputPath);
+  }
+  FString row = FString::Printf(TEXT("%s,%s,%d,%d,%d,%d,%.3f,%.1f,%.3f,%.3f,%lld,%.3f,%.3f\n"),
+                                *FDateTime::Now().ToIso8601(), *FPaths::GetCleanFilename(logPath), maxSpeed ? 1 : 0, loops,
+                                queries, invocations, elapsed, queriesPerSecond, p50, p99, responder.Failures,
+                                invocationP50, invocationP99);
+  FFileHelper::SaveStringToFile(row, *outputPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+  UE_LOG(LogNEON, Display, TEXT("Written to %s"), *outputPath);
+
+  return 0;
+}
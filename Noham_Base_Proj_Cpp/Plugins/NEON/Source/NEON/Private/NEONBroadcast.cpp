@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBroadcast.cpp
+
+#include "NEONBroadcast.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include "NEONLogging.h"
+#include "NEONStats.h"
+#include "UNEONWidget.h"
+
+void FNEONBroadcast::Subscribe(UNEONWidget *Widget, FName Topic)
+{
+  check(IsInGameThread());
+  if (!Widget || Topic.IsNone())
+  {
+    return;
+  }
+  _Subscribers.FindOrAdd(Topic).AddUnique(Widget);
+  OnSubscribed.Broadcast(Topic, Widget);
+}
+
+void FNEONBroadcast::Unsubscribe(UNEONWidget *Widget, FName Topic)
+{
+  check(IsInGameThread());
+  if (TArray<TWeakObjectPtr<UNEONWidget>> *subscribers = _Subscribers.Find(Topic))
+  {
+    subscribers->Remove(Widget);
+    if (subscribers->IsEmpty())
+    {
+      _Subscribers.Remove(Topic);
+    }
+  }
+}
+
+void FNEONBroadcast::UnsubscribeAll(UNEONWidget *Widget)
+{
+  check(IsInGameThread());
+  for (auto it = _Subscribers.CreateIterator(); it; ++it)
+  {
+    it->Value.Remove(Widget);
+    if (it->Value.IsEmpty())
+    {
+      it.RemoveCurrent();
+    }
+  }
+}
+
+int32 FNEONBroadcast::Publish(FName Topic, const TSharedRef<FJsonObject> &JsonObject)
+{
+  // Nobody listens, don't serialize
+  if (GetSubscriberCount(Topic) == 0)
+  {
+    return 0;
+  }
+
+  FString jsonData;
+  TSharedRef<TJsonWriter<>> writer = TJsonWriterFactory<>::Create(&jsonData);
+  FJsonSerializer::Serialize(JsonObject, writer);
+
+  FString escapedJson = UNEONWidget::EscapeScriptString(jsonData);
+
+  return Deliver(Topic, FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", \"%s\");"), *Topic.ToString(), *escapedJson), jsonData);
+}
+
+int32 FNEONBroadcast::Publish(FName Topic)
+{
+  if (GetSubscriberCount(Topic) == 0)
+  {
+    return 0;
+  }
+  return Deliver(Topic, FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\");"), *Topic.ToString()), FString());
+}
+
+int32 FNEONBroadcast::GetSubscriberCount(FName Topic) const
+{
+  const TArray<TWeakObjectPtr<UNEONWidget>> *subscribers = _Subscribers.Find(Topic);
+  return subscribers ? subscribers->Num() : 0;
+}
+
+int32 FNEONBroadcast::Deliver(FName Topic, const FString &Script, const FString &Json)
+{
+  check(IsInGameThread());
+
+  TSharedRef<FNEONTopicMessage, ESPMode::ThreadSafe> message = MakeShared<FNEONTopicMessage, ESPMode::ThreadSafe>();
+  message->Topic = Topic;
+  message->Json = Json;
+  message->Script = Script;
+  message->CefScript = *Script;
+
+  INC_DWORD_STAT(STAT_NEON_TopicPublishes);
+  CSV_CUSTOM_STAT(NEON, TopicPublishes, 1, ECsvCustomStatOp::Accumulate);
+
+  int32 delivered = 0;
+  TArray<TWeakObjectPtr<UNEONWidget>> &subscribers = _Subscribers.FindChecked(Topic);
+  for (int32 i = subscribers.Num() - 1; i >= 0; --i)
+  {
+    UNEONWidget *widget = subscribers[i].Get();
+    if (!widget)
+    {
+      subscribers.RemoveAtSwap(i);
+      continue;
+    }
+    widget->EnqueueTopicMessage(message);
+    delivered++;
+  }
+  if (subscribers.IsEmpty())
+  {
+    _Subscribers.Remove(Topic);
+  }
+
+  UE_LOG(LogNEON, Verbose, TEXT("Published '%s' to %d widgets."), *Topic.ToString(), delivered);
+  return delivered;
+}
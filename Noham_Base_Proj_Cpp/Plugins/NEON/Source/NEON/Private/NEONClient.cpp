@@ -5,13 +5,20 @@
 // NEONClient.cpp
 
 #include "NEONClient.h"
+#include "Modules/ModuleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "NEON.h"
 #include "NEONLogging.h"
+#include "NEONStats.h"
 #include "NEONMessageHandler.h"
 #include "UNEONWidget.h"
 
 NEONClient::NEONClient(NEONMessageHandler *MessageHandler)
-    : _MessageHandler(MessageHandler)
+    : _MessageHandler(MessageHandler),
+      _AudioStream(MakeShared<FNEONAudioStream, ESPMode::ThreadSafe>())
 {
+  _RouteAudio = FModuleManager::GetModuleChecked<FNEONModule>("NEON").GetProfile().bRouteAudio;
+
   CefMessageRouterConfig config;
   _MessageRouter = CefMessageRouterBrowserSide::Create(config);
   _MessageRouter->AddHandler(MessageHandler, false);
@@ -76,20 +83,22 @@ bool NEONClient::OnBeforePopup(CefRefPtr<CefBrowser> browser,
 //----------------------------------------------------------------------
 void NEONClient::GetViewRect(CefRefPtr<CefBrowser> browser, CefRect &rect)
 {
-  rect = CefRect(0, 0, _Width, _Height);
+  // _Width/_Height are texture pixels. CEF paints ceil(DIP * scale) pixels, rounding the DIP size down gives back
+  // exactly the texture size for any scale <= 1; rounding to nearest can paint one pixel more and never match.
+  rect = CefRect(0, 0, FMath::Max(FMath::FloorToInt(_Width / _RenderScale), 1), FMath::Max(FMath::FloorToInt(_Height / _RenderScale), 1));
 }
 
 bool NEONClient::GetScreenInfo(CefRefPtr<CefBrowser> browser, CefScreenInfo &screen_info)
 {
-  screen_info.device_scale_factor = 1.0f;
-  screen_info.rect = CefRect(0, 0, _Width, _Height);
+  screen_info.device_scale_factor = _RenderScale;
+  GetViewRect(browser, screen_info.rect);
   screen_info.available_rect = screen_info.rect;
   return true;
 }
 
 bool NEONClient::GetRootScreenRect(CefRefPtr<CefBrowser> browser, CefRect &rect)
 {
-  rect = CefRect(0, 0, _Width, _Height);
+  GetViewRect(browser, rect);
   return true;
 }
 
@@ -109,8 +118,9 @@ void NEONClient::OnPopupSize(CefRefPtr<CefBrowser> /*browser*/, const CefRect &r
 {
   if (_Widget)
   {
-    // store popup geometry (in device px)
-    _Widget->SetPopupRect(rect.x, rect.y, rect.width, rect.height);
+    // CEF reports DIP, the popup is composited in texture pixels
+    _Widget->SetPopupRect(FMath::RoundToInt(rect.x * _RenderScale), FMath::RoundToInt(rect.y * _RenderScale),
+                          FMath::RoundToInt(rect.width * _RenderScale), FMath::RoundToInt(rect.height * _RenderScale));
   }
 }
 
@@ -122,6 +132,13 @@ void NEONClient::OnAcceleratedPaint(CefRefPtr<CefBrowser> browser,
                                     const CefRenderHandler::RectList & /*dirtyRects*/,
                                     const CefAcceleratedPaintInfo &paintInfo)
 {
+  // Shows up in Insights, line up with the Chromium trace via NEON.ClockSync (see NEONTrace.h)
+  TRACE_CPUPROFILER_EVENT_SCOPE(NEON_OnAcceleratedPaint);
+  SCOPE_CYCLE_COUNTER(STAT_NEON_Paint);
+  CSV_SCOPED_TIMING_STAT(NEON, Paint);
+  INC_DWORD_STAT(STAT_NEON_Paints);
+  CSV_CUSTOM_STAT(NEON, Paints, 1, ECsvCustomStatOp::Accumulate);
+
   if (!paintInfo.shared_texture_handle)
   {
     UE_LOG(LogNEON, Error, TEXT("Shared texture handle is null."));
@@ -129,7 +146,7 @@ void NEONClient::OnAcceleratedPaint(CefRefPtr<CefBrowser> browser,
   }
   if (!_Widget)
   {
-    UE_LOG(LogNEON, Warning, TEXT("Widget is null. This might happen when the widget is closed but CEF is still sending frames."));
+    UE_LOG(LogNEON, Verbose, TEXT("Widget is null. This might happen when the widget is closed but CEF is still sending frames."));
     return;
   }
 
@@ -141,4 +158,167 @@ void NEONClient::OnAcceleratedPaint(CefRefPtr<CefBrowser> browser,
   {
     _Widget->OnAcceleratedPaint_Widget_Popup(paintInfo.shared_texture_handle);
   }
-}
\ No newline at end of file
+}
+//----------------------------------------------------------------------
+// Renderer health
+//----------------------------------------------------------------------
+bool NEONClient::IsWidgetBrowser(CefRefPtr<CefBrowser> browser) const
+{
+  return _Widget && _Widget->GetBrowser() && browser && browser->IsSame(_Widget->GetBrowser());
+}
+
+bool NEONClient::OnBeforeBrowse(CefRefPtr<CefBrowser> browser,
+                                CefRefPtr<CefFrame> frame,
+                                CefRefPtr<CefRequest> /*request*/,
+                                bool /*user_gesture*/,
+                                bool /*is_redirect*/)
+{
+  // Cancels pending queries of the document being replaced
+  _MessageRouter->OnBeforeBrowse(browser, frame);
+  return false;
+}
+
+bool NEONClient::OnRenderProcessUnresponsive(CefRefPtr<CefBrowser> browser,
+                                             CefRefPtr<CefUnresponsiveProcessCallback> callback)
+{
+  if (!IsWidgetBrowser(browser))
+  {
+    return false;
+  }
+  return _Widget->HandleRenderProcessUnresponsive(callback);
+}
+
+void NEONClient::OnRenderProcessResponsive(CefRefPtr<CefBrowser> browser)
+{
+  if (IsWidgetBrowser(browser))
+  {
+    _Widget->HandleRenderProcessResponsive();
+  }
+}
+
+void NEONClient::OnRenderProcessTerminated(CefRefPtr<CefBrowser> browser,
+                                           TerminationStatus status,
+                                           int error_code,
+                                           const CefString &error_string)
+{
+  _MessageRouter->OnRenderProcessTerminated(browser);
+
+  UE_LOG(LogNEON, Error, TEXT("Render process terminated. Status: %d, error: %d %s"), static_cast<int32>(status), error_code, error_string.ToWString().c_str());
+
+  if (IsWidgetBrowser(browser))
+  {
+    _Widget->HandleRenderProcessTerminated(static_cast<int32>(status));
+  }
+}
+
+void NEONClient::OnLoadEnd(CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, int httpStatusCode)
+{
+  if (frame->IsMain() && IsWidgetBrowser(browser))
+  {
+    _Widget->HandleMainFrameLoaded(httpStatusCode);
+  }
+}
+
+//----------------------------------------------------------------------
+// Cursor, mirrored into Slate
+//----------------------------------------------------------------------
+namespace
+{
+  EMouseCursor::Type GetSlateCursor(cef_cursor_type_t Type)
+  {
+    switch (Type)
+    {
+    case CT_NONE:
+      return EMouseCursor::None;
+    case CT_CROSS:
+      return EMouseCursor::Crosshairs;
+    case CT_HAND:
+      return EMouseCursor::Hand;
+    case CT_IBEAM:
+    case CT_VERTICALTEXT:
+      return EMouseCursor::TextEditBeam;
+    case CT_EASTRESIZE:
+    case CT_WESTRESIZE:
+    case CT_EASTWESTRESIZE:
+    case CT_COLUMNRESIZE:
+    case CT_EASTPANNING:
+    case CT_WESTPANNING:
+      return EMouseCursor::ResizeLeftRight;
+    case CT_NORTHRESIZE:
+    case CT_SOUTHRESIZE:
+    case CT_NORTHSOUTHRESIZE:
+    case CT_ROWRESIZE:
+    case CT_NORTHPANNING:
+    case CT_SOUTHPANNING:
+      return EMouseCursor::ResizeUpDown;
+    case CT_NORTHWESTRESIZE:
+    case CT_SOUTHEASTRESIZE:
+    case CT_NORTHWESTSOUTHEASTRESIZE:
+      return EMouseCursor::ResizeSouthEast;
+    case CT_NORTHEASTRESIZE:
+    case CT_SOUTHWESTRESIZE:
+    case CT_NORTHEASTSOUTHWESTRESIZE:
+      return EMouseCursor::ResizeSouthWest;
+    case CT_MOVE:
+    case CT_MIDDLEPANNING:
+    case CT_ALLSCROLL:
+      return EMouseCursor::CardinalCross;
+    case CT_NOTALLOWED:
+    case CT_NODROP:
+      return EMouseCursor::SlashedCircle;
+    case CT_GRAB:
+      return EMouseCursor::GrabHand;
+    case CT_GRABBING:
+      return EMouseCursor::GrabHandClosed;
+    default:
+      return EMouseCursor::Default;
+    }
+  }
+}
+
+bool NEONClient::OnCursorChange(CefRefPtr<CefBrowser> browser,
+                                CefCursorHandle /*cursor*/,
+                                cef_cursor_type_t type,
+                                const CefCursorInfo & /*custom_cursor_info*/)
+{
+  if (!IsWidgetBrowser(browser))
+  {
+    return false;
+  }
+  // Handled, CEF must not set the OS cursor behind Slate's back
+  _Widget->HandleCursorChange(GetSlateCursor(type));
+  return true;
+}
+
+//----------------------------------------------------------------------
+// Audio, routed into UNEONAudioComponent
+//----------------------------------------------------------------------
+bool NEONClient::GetAudioParameters(CefRefPtr<CefBrowser> browser, CefAudioParameters &params)
+{
+  // FNEONAudioStream keeps at most two channels, don't let Chromium upmix
+  params.channel_layout = CEF_CHANNEL_LAYOUT_STEREO;
+  return true;
+}
+
+void NEONClient::OnAudioStreamStarted(CefRefPtr<CefBrowser> browser, const CefAudioParameters &params, int channels)
+{
+  UE_LOG(LogNEON, Verbose, TEXT("Audio stream started: %d Hz, %d channels"), params.sample_rate, channels);
+  _AudioStream->Start(params.sample_rate, channels);
+}
+
+void NEONClient::OnAudioStreamPacket(CefRefPtr<CefBrowser> browser, const float **data, int frames, int64_t pts)
+{
+  _AudioStream->Push(data, frames);
+}
+
+void NEONClient::OnAudioStreamStopped(CefRefPtr<CefBrowser> browser)
+{
+  UE_LOG(LogNEON, Verbose, TEXT("Audio stream stopped (%lld samples dropped)"), _AudioStream->GetDroppedSamples());
+  _AudioStream->Stop();
+}
+
+void NEONClient::OnAudioStreamError(CefRefPtr<CefBrowser> browser, const CefString &message)
+{
+  UE_LOG(LogNEON, Warning, TEXT("Audio stream error: %s"), message.ToWString().c_str());
+  _AudioStream->Stop();
+}
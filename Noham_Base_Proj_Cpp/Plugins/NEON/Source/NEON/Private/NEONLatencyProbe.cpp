@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONLatencyProbe.cpp
+
+#include "NEONLatencyProbe.h"
+#include "HAL/PlatformTime.h"
+
+#include "NEONStats.h"
+
+void FNEONLatencyProbe::Reset()
+{
+  _Pending.Reset();
+  _AwaitingPaint.Reset();
+  _Samples.Reset();
+  _NextSample = 0;
+  _Sequence = 0;
+  _P50 = _P95 = _P99 = 0.0f;
+}
+
+void FNEONLatencyProbe::OnInput()
+{
+  // The page stopped echoing (reload, probe not installed). Don't grow forever.
+  if (_Pending.Num() >= MaxPending)
+  {
+    _Pending.RemoveAt(0);
+  }
+  _Pending.Add({++_Sequence, FPlatformTime::Seconds()});
+}
+
+void FNEONLatencyProbe::OnEcho(int32 Sequence)
+{
+  // Inputs older than the echoed one were dropped by the page
+  int32 index = _Pending.IndexOfByPredicate([Sequence](const FPendingInput &Input)
+                                            { return Input.Sequence == Sequence; });
+  if (index == INDEX_NONE)
+  {
+    return;
+  }
+
+  _AwaitingPaint.Add(_Pending[index].Time);
+  _Pending.RemoveAt(0, index + 1);
+}
+
+void FNEONLatencyProbe::OnPaint()
+{
+  if (_AwaitingPaint.IsEmpty())
+  {
+    return;
+  }
+
+  const double now = FPlatformTime::Seconds();
+  for (double inputTime : _AwaitingPaint)
+  {
+    const float sample = static_cast<float>((now - inputTime) * 1000.0);
+    if (_Samples.Num() < MaxSamples)
+    {
+      _Samples.Add(sample);
+    }
+    else
+    {
+      _Samples[_NextSample] = sample;
+    }
+    _NextSample = (_NextSample + 1) % MaxSamples;
+  }
+  _AwaitingPaint.Reset();
+
+  // Only recomputed when samples arrive, Publish runs every frame
+  TArray<float> sorted = _Samples;
+  sorted.Sort();
+  auto percentile = [&sorted](float P)
+  {
+    return sorted[FMath::Clamp(FMath::CeilToInt(P * sorted.Num()) - 1, 0, sorted.Num() - 1)];
+  };
+  _P50 = percentile(0.50f);
+  _P95 = percentile(0.95f);
+  _P99 = percentile(0.99f);
+}
+
+bool FNEONLatencyProbe::GetPercentiles(float &OutP50, float &OutP95, float &OutP99) const
+{
+  OutP50 = _P50;
+  OutP95 = _P95;
+  OutP99 = _P99;
+  return !_Samples.IsEmpty();
+}
+
+void FNEONLatencyProbe::Publish(const FString &WidgetName) const
+{
+  float p50, p95, p99;
+  if (!GetPercentiles(p50, p95, p99))
+  {
+    return;
+  }
+
+  SET_FLOAT_STAT(STAT_NEON_InputLatencyP50, p50);
+  SET_FLOAT_STAT(STAT_NEON_InputLatencyP95, p95);
+  SET_FLOAT_STAT(STAT_NEON_InputLatencyP99, p99);
+
+#if CSV_PROFILER
+  if (FCsvProfiler::Get()->IsCapturing())
+  {
+    const int32 categoryIndex = CSV_CATEGORY_INDEX(NEON);
+    FCsvProfiler::RecordCustomStat(FName(WidgetName + TEXT("_LatencyP50")), categoryIndex, p50, ECsvCustomStatOp::Set);
+    FCsvProfiler::RecordCustomStat(FName(WidgetName + TEXT("_LatencyP95")), categoryIndex, p95, ECsvCustomStatOp::Set);
+    FCsvProfiler::RecordCustomStat(FName(WidgetName + TEXT("_LatencyP99")), categoryIndex, p99, ECsvCustomStatOp::Set);
+  }
+#endif
+}
@@ -7,39 +7,43 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "Misc/ScopeExit.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
+#include "NEONBridgeBindings.h"
+#include "NEONBridgeRecorder.h"
 #include "NEONLogging.h"
+#include "NEONStats.h"
 #include "UNEONWidget.h"
 #include "NEONClient.h"
 
-CefString GetErrorMessage(ENEONErrorCode ErrorCode)
+FString GetErrorMessage(ENEONErrorCode ErrorCode)
 {
   switch (ErrorCode)
   {
   case ENEONErrorCode::InvalidJson:
-    return "Invalid JSON data";
+    return TEXT("Invalid JSON data");
   case ENEONErrorCode::MissingDelegateTypeField:
-    return "Missing delegate type field";
+    return TEXT("Missing delegate type field");
   case ENEONErrorCode::InvalidDelegateType:
-    return "Invalid delegate type";
+    return TEXT("Invalid delegate type");
   case ENEONErrorCode::MissingDelegateField:
-    return "Missing delegate field";
+    return TEXT("Missing delegate field");
   case ENEONErrorCode::MissingParametersField:
-    return "Missing parameters field";
+    return TEXT("Missing parameters field");
   case ENEONErrorCode::DelegateNotFound:
-    return "Delegate not found";
+    return TEXT("Delegate not found");
   case ENEONErrorCode::UnsupportedPropertyType:
-    return "Unsupported property type";
+    return TEXT("Unsupported property type");
   case ENEONErrorCode::InvalidInput:
-    return "Invalid input";
+    return TEXT("Invalid input");
   case ENEONErrorCode::UnexpectedParameterType:
-    return "Unexpected parameter type";
+    return TEXT("Unexpected parameter type");
   case ENEONErrorCode::MissingParameter:
-    return "Missing parameter";
+    return TEXT("Missing parameter");
   default:
-    return "Unknown error";
+    return TEXT("Unknown error");
   }
 }
 
@@ -66,6 +70,28 @@ inline FString NEONMessageHandler::GetJsonTypeAsString(EJson Type)
   }
 }
 
+namespace
+{
+  // Forwards bridge results to the CEF message router callback
+  class NEONCefBridgeResponder : public NEONBridgeResponder
+  {
+  public:
+    NEONCefBridgeResponder(CefRefPtr<CefMessageRouterBrowserSide::Callback> Callback) : _Callback(Callback) {}
+
+    void Success(const FString &Response) override
+    {
+      _Callback->Success(TCHAR_TO_UTF8(*Response));
+    }
+    void Failure(int32 ErrorCode, const FString &ErrorMessage) override
+    {
+      _Callback->Failure(ErrorCode, TCHAR_TO_UTF8(*ErrorMessage));
+    }
+
+  private:
+    CefRefPtr<CefMessageRouterBrowserSide::Callback> _Callback;
+  };
+}
+
 bool NEONMessageHandler::OnQuery(CefRefPtr<CefBrowser> Browser,
                                  CefRefPtr<CefFrame> Frame,
                                  int64 QueryId,
@@ -73,16 +99,38 @@ bool NEONMessageHandler::OnQuery(CefRefPtr<CefBrowser> Browser,
                                  bool Persistent,
                                  CefRefPtr<Callback> Callback)
 {
-  FString requestUnrealString = Request.ToString().c_str();
-  UE_LOG(LogNEONMessageHandler, Verbose, TEXT("NEONMessageHandler OnQuery: %s"), *requestUnrealString);
+  const double queryStart = FPlatformTime::Seconds();
+
+  NEONCefBridgeResponder responder(Callback);
+  const bool handled = HandleQuery(FString(Request.ToWString().c_str()), responder);
+
+  if (_Widget)
+  {
+    _Widget->RecordQueryDispatchTime((FPlatformTime::Seconds() - queryStart) * 1000.0);
+  }
+  return handled;
+}
+
+bool NEONMessageHandler::HandleQuery(const FString &Request, NEONBridgeResponder &Responder)
+{
+  UE_LOG(LogNEONMessageHandler, Verbose, TEXT("NEONMessageHandler OnQuery: %s"), *Request);
+  INC_DWORD_STAT(STAT_NEON_Queries);
+  CSV_CUSTOM_STAT(NEON, Queries, 1, ECsvCustomStatOp::Accumulate);
+  FNEONBridgeRecorder::RecordQuery(_Widget, Request);
 
   // Parse the JSON string
   TSharedPtr<FJsonObject> jsonObject;
-  TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(requestUnrealString);
-  if (!FJsonSerializer::Deserialize(reader, jsonObject) || !jsonObject.IsValid())
+  bool parsed = false;
   {
-    UE_LOG(LogNEONMessageHandler, Error, TEXT("Failed to parse JSON data: %s"), *requestUnrealString);
-    Callback->Failure(static_cast<int>(ENEONErrorCode::InvalidJson), GetErrorMessage(ENEONErrorCode::InvalidJson));
+    SCOPE_CYCLE_COUNTER(STAT_NEON_QueryDecode);
+    CSV_SCOPED_TIMING_STAT(NEON, QueryDecode);
+    TSharedRef<TJsonReader<>> reader = TJsonReaderFactory<>::Create(Request);
+    parsed = FJsonSerializer::Deserialize(reader, jsonObject);
+  }
+  if (!parsed || !jsonObject.IsValid())
+  {
+    UE_LOG(LogNEONMessageHandler, Error, TEXT("Failed to parse JSON data: %s"), *Request);
+    Responder.Failure(static_cast<int>(ENEONErrorCode::InvalidJson), GetErrorMessage(ENEONErrorCode::InvalidJson));
     return true;
   }
 
@@ -91,41 +139,105 @@ bool NEONMessageHandler::OnQuery(CefRefPtr<CefBrowser> Browser,
   if (!jsonObject->HasField(TEXT("type")) || jsonObject->GetStringField(TEXT("type")).IsEmpty())
   {
     UE_LOG(LogNEONMessageHandler, Error, TEXT("No delegate type field in JSON data"));
-    Callback->Failure(static_cast<int>(ENEONErrorCode::MissingDelegateTypeField), GetErrorMessage(ENEONErrorCode::MissingDelegateTypeField));
+    Responder.Failure(static_cast<int>(ENEONErrorCode::MissingDelegateTypeField), GetErrorMessage(ENEONErrorCode::MissingDelegateTypeField));
     return true;
   }
   FString type = jsonObject->GetStringField(TEXT("type"));
+
+  // Latency probe echo, see NEONLatencyProbe.h
+  if (type == TEXT("latency"))
+  {
+    _Widget->HandleLatencyEcho(static_cast<int32>(jsonObject->GetNumberField(TEXT("sequence"))));
+    Responder.Success(FString());
+    return true;
+  }
+
+  // Round trip times measured by the page, see NEON_Bridge_Timing in neon-ue-web
+  if (type == TEXT("timing"))
+  {
+    _Widget->RecordQueryRoundTrips(static_cast<int32>(jsonObject->GetNumberField(TEXT("count"))),
+                                   jsonObject->GetNumberField(TEXT("totalMs")), jsonObject->GetNumberField(TEXT("maxMs")));
+    Responder.Success(FString());
+    return true;
+  }
+
+  // Topic subscriptions requested by the page, see NEON.subscribe in neon-ue-web
+  if (type == TEXT("subscribe") || type == TEXT("unsubscribe"))
+  {
+    FString topic;
+    if (!jsonObject->TryGetStringField(TEXT("topic"), topic) || topic.IsEmpty())
+    {
+      UE_LOG(LogNEONMessageHandler, Error, TEXT("No topic field in %s query"), *type);
+      Responder.Failure(static_cast<int>(ENEONErrorCode::InvalidInput), GetErrorMessage(ENEONErrorCode::InvalidInput));
+      return true;
+    }
+    if (type == TEXT("subscribe"))
+    {
+      _Widget->SubscribeTopic(FName(*topic));
+    }
+    else
+    {
+      _Widget->UnsubscribeTopic(FName(*topic));
+    }
+    Responder.Success(FString());
+    return true;
+  }
+
   if (type != TEXT("function") && type != TEXT("event"))
   {
     UE_LOG(LogNEONMessageHandler, Error, TEXT("Invalid delegate type: %s"), *type);
-    Callback->Failure(static_cast<int>(ENEONErrorCode::InvalidDelegateType), GetErrorMessage(ENEONErrorCode::InvalidDelegateType));
+    Responder.Failure(static_cast<int>(ENEONErrorCode::InvalidDelegateType), GetErrorMessage(ENEONErrorCode::InvalidDelegateType));
     return true;
   }
 
-  // - delegate
-  if (!jsonObject->HasField(TEXT("delegate")) || jsonObject->GetStringField(TEXT("delegate")).IsEmpty())
+  // - delegate, by binding id (see NEONBridgeBindings.h) or by name
+  UFunction *delegateFunction = nullptr;
+  double delegateId = 0.0;
+  if (jsonObject->TryGetNumberField(TEXT("id"), delegateId))
+  {
+    delegateFunction = FindDelegate(static_cast<uint32>(delegateId));
+    // An ID of an event must not run as a function and vice versa, same prefix check as the name path
+    if (delegateFunction && !(type == TEXT("function") ? FNEONBridgeBindings::IsFunction(delegateFunction) : FNEONBridgeBindings::IsEvent(delegateFunction)))
+    {
+      delegateFunction = nullptr;
+    }
+    if (!delegateFunction)
+    {
+      UE_LOG(LogNEONMessageHandler, Error, TEXT("No %s delegate with id %u"), *type, static_cast<uint32>(delegateId));
+      Responder.Failure(static_cast<int>(ENEONErrorCode::DelegateNotFound), GetErrorMessage(ENEONErrorCode::DelegateNotFound));
+      return true;
+    }
+  }
+  else if (!jsonObject->HasField(TEXT("delegate")) || jsonObject->GetStringField(TEXT("delegate")).IsEmpty())
   {
     UE_LOG(LogNEONMessageHandler, Error, TEXT("No delegate field in JSON data"));
-    Callback->Failure(static_cast<int>(ENEONErrorCode::MissingDelegateField), GetErrorMessage(ENEONErrorCode::MissingDelegateField));
+    Responder.Failure(static_cast<int>(ENEONErrorCode::MissingDelegateField), GetErrorMessage(ENEONErrorCode::MissingDelegateField));
     return true;
   }
-  FString delegate = jsonObject->GetStringField(TEXT("delegate"));
 
   // - parameters
   if (!jsonObject->HasField(TEXT("parameters")) || !jsonObject->GetObjectField(TEXT("parameters")).IsValid())
   {
     UE_LOG(LogNEONMessageHandler, Error, TEXT("No parameters field in JSON data"));
-    Callback->Failure(static_cast<int>(ENEONErrorCode::MissingParametersField), GetErrorMessage(ENEONErrorCode::MissingParametersField));
+    Responder.Failure(static_cast<int>(ENEONErrorCode::MissingParametersField), GetErrorMessage(ENEONErrorCode::MissingParametersField));
     return true;
   }
 
+  if (delegateFunction)
+  {
+    return type == TEXT("function")
+               ? InvokeFunction(delegateFunction, jsonObject->GetObjectField(TEXT("parameters")), Responder)
+               : InvokeEvent(delegateFunction, jsonObject->GetObjectField(TEXT("parameters")), Responder);
+  }
+
+  FString delegate = jsonObject->GetStringField(TEXT("delegate"));
   if (type == TEXT("function"))
   {
-    return InvokeFunction(delegate, jsonObject->GetObjectField(TEXT("parameters")), Callback);
+    return InvokeFunction(delegate, jsonObject->GetObjectField(TEXT("parameters")), Responder);
   }
   else if (type == TEXT("event"))
   {
-    return InvokeEvent(delegate, jsonObject->GetObjectField(TEXT("parameters")), Callback);
+    return InvokeEvent(delegate, jsonObject->GetObjectField(TEXT("parameters")), Responder);
   }
 
   // This shouldn't happen as all delegate types are accounted for. Return false means query was not handled
@@ -133,7 +245,16 @@ bool NEONMessageHandler::OnQuery(CefRefPtr<CefBrowser> Browser,
   return false;
 }
 
-bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedPtr<FJsonObject> JSON, uint8 *ParamsBuffer, CefRefPtr<Callback> Callback)
+// Strings, arrays and JsonObjectWrappers are assigned into the zeroed buffer and own heap memory
+void NEONMessageHandler::DestroyParamsBuffer(UFunction *DelegateFunction, uint8 *ParamsBuffer)
+{
+  for (TFieldIterator<FProperty> propertyIt(DelegateFunction); propertyIt && propertyIt->HasAnyPropertyFlags(CPF_Parm); ++propertyIt)
+  {
+    propertyIt->DestroyValue_InContainer(ParamsBuffer);
+  }
+}
+
+bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedPtr<FJsonObject> JSON, uint8 *ParamsBuffer, NEONBridgeResponder &Responder)
 {
   FMemory::Memzero(ParamsBuffer, DelegateFunction->ParmsSize);
 
@@ -159,13 +280,8 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
     if (!JSON->HasField(propertyName))
     {
       UE_LOG(LogNEONMessageHandler, Error, TEXT("Delegate function '%s' missing parameter in passed arguments: %s"), *DelegateFunction->GetName(), *propertyName);
-      CefString paramName = *propertyName;
-
-      // Concatenate error message
-      CefString errorMessage = GetErrorMessage(ENEONErrorCode::MissingParameter).ToWString() + L": " + paramName.ToWString();
-
-      // Call the Failure method with the correct arguments
-      Callback->Failure(static_cast<int>(ENEONErrorCode::MissingParameter), errorMessage);
+      FString errorMessage = GetErrorMessage(ENEONErrorCode::MissingParameter) + TEXT(": ") + propertyName;
+      Responder.Failure(static_cast<int>(ENEONErrorCode::MissingParameter), errorMessage);
       continue;
     }
 
@@ -195,7 +311,7 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
 
       bool value = fieldValue->AsBool();
       boolProperty->SetPropertyValue(propertyAddress, value);
-      UE_LOG(LogNEONMessageHandler, Log, TEXT("Set input property: %s to %s"), *propertyName, value ? TEXT("true") : TEXT("false"));
+      UE_LOG(LogNEONMessageHandler, Verbose, TEXT("Set input property: %s to %s"), *propertyName, value ? TEXT("true") : TEXT("false"));
     }
     // - numeric (float, double, int32, int64)
     else if (FNumericProperty *numericProperty = CastField<FNumericProperty>(property))
@@ -218,7 +334,7 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
       else
       {
         UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported numeric property type: %s"), *propertyName);
-        Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+        Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
         return false;
       }
       UE_LOG(LogNEONMessageHandler, Verbose, TEXT("Set input property: %s to %f"), *propertyName, numberValue);
@@ -241,7 +357,7 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
       if (structProperty->Struct->GetFName() != FName(TEXT("JsonObjectWrapper")))
       {
         UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported struct property type: %s"), *propertyName);
-        Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+        Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
         return false;
       }
 
@@ -255,14 +371,14 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
       if (fieldValue->Type != EJson::Object)
       {
         UE_LOG(LogNEONMessageHandler, Error, TEXT("Unexpected parameter type for %s"), *propertyName);
-        Callback->Failure(static_cast<int>(ENEONErrorCode::UnexpectedParameterType), GetErrorMessage(ENEONErrorCode::UnexpectedParameterType));
+        Responder.Failure(static_cast<int>(ENEONErrorCode::UnexpectedParameterType), GetErrorMessage(ENEONErrorCode::UnexpectedParameterType));
         return false;
       }
       TSharedPtr<FJsonObject> inputObject = fieldValue->AsObject();
       if (!inputObject.IsValid())
       {
         UE_LOG(LogNEONMessageHandler, Error, TEXT("Invalid JsonObjectWrapper input for property: %s"), *propertyName);
-        Callback->Failure(static_cast<int>(ENEONErrorCode::InvalidInput), GetErrorMessage(ENEONErrorCode::InvalidInput));
+        Responder.Failure(static_cast<int>(ENEONErrorCode::InvalidInput), GetErrorMessage(ENEONErrorCode::InvalidInput));
         return false;
       }
 
@@ -326,7 +442,7 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
           else
           {
             UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported numeric type in array for property: %s"), *propertyName);
-            Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+            Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
             return false;
           }
         }
@@ -344,20 +460,20 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
           if (structInner->Struct->GetFName() != FName(TEXT("JsonObjectWrapper")))
           {
             UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported struct type in array for property: %s"), *propertyName);
-            Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+            Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
             return false;
           }
           if (jsonElement->Type != EJson::Object)
           {
             UE_LOG(LogNEONMessageHandler, Error, TEXT("Unexpected array element type for %s. Expected object for JsonObjectWrapper"), *propertyName);
-            Callback->Failure(static_cast<int>(ENEONErrorCode::UnexpectedParameterType), GetErrorMessage(ENEONErrorCode::UnexpectedParameterType));
+            Responder.Failure(static_cast<int>(ENEONErrorCode::UnexpectedParameterType), GetErrorMessage(ENEONErrorCode::UnexpectedParameterType));
             return false;
           }
           TSharedPtr<FJsonObject> inputObject = jsonElement->AsObject();
           if (!inputObject.IsValid())
           {
             UE_LOG(LogNEONMessageHandler, Error, TEXT("Invalid JsonObjectWrapper in array for property: %s"), *propertyName);
-            Callback->Failure(static_cast<int>(ENEONErrorCode::InvalidInput), GetErrorMessage(ENEONErrorCode::InvalidInput));
+            Responder.Failure(static_cast<int>(ENEONErrorCode::InvalidInput), GetErrorMessage(ENEONErrorCode::InvalidInput));
             return false;
           }
           FString subJsonString;
@@ -373,7 +489,7 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
         else
         {
           UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported array element type for property: %s"), *propertyName);
-          Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+          Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
           return false;
         }
       }
@@ -383,7 +499,7 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
     else
     {
       UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported property type: %s"), *propertyName);
-      Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+      Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
       return true;
     }
   }
@@ -391,29 +507,48 @@ bool NEONMessageHandler::BuildParamsBuffer(UFunction *DelegateFunction, TSharedP
   return true;
 }
 
-bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JSON, CefRefPtr<Callback> Callback)
+bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JSON, NEONBridgeResponder &Responder)
 {
-  // Find the function by name
+  // Find the function by name. Only Invoke_* functions are callable, not every UFUNCTION of the widget.
   UFunction *delegateFunction = _Widget->FindFunction(*Name);
-  if (!delegateFunction)
+  if (!FNEONBridgeBindings::IsFunction(delegateFunction))
   {
     UE_LOG(LogNEONMessageHandler, Error, TEXT("Function not found: %s"), *Name);
-    Callback->Failure(static_cast<int>(ENEONErrorCode::DelegateNotFound), GetErrorMessage(ENEONErrorCode::DelegateNotFound));
+    Responder.Failure(static_cast<int>(ENEONErrorCode::DelegateNotFound), GetErrorMessage(ENEONErrorCode::DelegateNotFound));
     return true;
   }
+  return InvokeFunction(delegateFunction, JSON, Responder);
+}
 
+bool NEONMessageHandler::InvokeFunction(UFunction *DelegateFunction, TSharedPtr<FJsonObject> JSON, NEONBridgeResponder &Responder)
+{
   // Prepare the parameters buffer and construct frame
-  uint8 *paramsBuffer = (uint8 *)FMemory_Alloca(delegateFunction->ParmsSize);
-  if (!BuildParamsBuffer(delegateFunction, JSON, paramsBuffer, Callback))
+  uint8 *paramsBuffer = (uint8 *)FMemory_Alloca(DelegateFunction->ParmsSize);
+  ON_SCOPE_EXIT { DestroyParamsBuffer(DelegateFunction, paramsBuffer); };
+  bool built = false;
+  {
+    SCOPE_CYCLE_COUNTER(STAT_NEON_QueryDecode);
+    CSV_SCOPED_TIMING_STAT(NEON, QueryDecode);
+    built = BuildParamsBuffer(DelegateFunction, JSON, paramsBuffer, Responder);
+  }
+  if (!built)
   {
     return true;
   }
 
   // UE_LOG(LogNEONMessageHandler, Verbose, TEXT("Parameters assembled, invoking function %s"), *Name);
-  _Widget->ProcessEvent(delegateFunction, paramsBuffer);
+  {
+    SCOPE_CYCLE_COUNTER(STAT_NEON_ProcessEvent);
+    CSV_SCOPED_TIMING_STAT(NEON, ProcessEvent);
+    _Widget->ProcessEvent(DelegateFunction, paramsBuffer);
+  }
+
+  // Covers reading the out parameters, serializing and handing the response to CEF
+  SCOPE_CYCLE_COUNTER(STAT_NEON_ResponseEncode);
+  CSV_SCOPED_TIMING_STAT(NEON, ResponseEncode);
 
   TSharedPtr<FJsonObject> jsonOut = MakeShared<FJsonObject>();
-  for (TFieldIterator<FProperty> iteratedProperty(delegateFunction); iteratedProperty; ++iteratedProperty)
+  for (TFieldIterator<FProperty> iteratedProperty(DelegateFunction); iteratedProperty; ++iteratedProperty)
   {
     FProperty *property = *iteratedProperty;
 
@@ -422,7 +557,7 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
 
     if (!property->HasAllPropertyFlags(CPF_OutParm) || property->HasAnyPropertyFlags(CPF_ReferenceParm))
     {
-      UE_LOG(LogNEONMessageHandler, Verbose, TEXT("Skipping property '%s' when building output params for delegate '%s'"), *property->GetName(), *delegateFunction->GetName());
+      UE_LOG(LogNEONMessageHandler, Verbose, TEXT("Skipping property '%s' when building output params for delegate '%s'"), *property->GetName(), *DelegateFunction->GetName());
       continue;
     }
 
@@ -456,7 +591,7 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
       else
       {
         UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported numeric property type: %s"), *propertyName);
-        Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+        Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
         return true;
       }
     }
@@ -471,7 +606,7 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
       if (structProperty->Struct->GetFName() != "JsonObjectWrapper")
       {
         UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported output property type: %s"), *propertyName);
-        Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+        Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
         return true;
       }
 
@@ -481,7 +616,7 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
       if (!outputObject.IsValid())
       {
         UE_LOG(LogNEONMessageHandler, Error, TEXT("Invalid JsonObjectWrapper output for property: %s"), *propertyName);
-        Callback->Failure(static_cast<int>(ENEONErrorCode::InvalidInput), GetErrorMessage(ENEONErrorCode::InvalidInput));
+        Responder.Failure(static_cast<int>(ENEONErrorCode::InvalidInput), GetErrorMessage(ENEONErrorCode::InvalidInput));
         return true;
       }
 
@@ -526,7 +661,7 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
           if (structInner->Struct->GetFName() != FName(TEXT("JsonObjectWrapper")))
           {
             UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported struct type in array for property: %s"), *propertyName);
-            Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType),
+            Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType),
                               GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
             return true;
           }
@@ -534,7 +669,7 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
           if (!jsonObjectWrapper->JsonObject.IsValid())
           {
             UE_LOG(LogNEONMessageHandler, Error, TEXT("Invalid JsonObjectWrapper output for array element in property: %s"), *propertyName);
-            Callback->Failure(static_cast<int>(ENEONErrorCode::InvalidInput),
+            Responder.Failure(static_cast<int>(ENEONErrorCode::InvalidInput),
                               GetErrorMessage(ENEONErrorCode::InvalidInput));
             return true;
           }
@@ -543,7 +678,7 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
         else
         {
           UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported array element type for property: %s"), *propertyName);
-          Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType),
+          Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType),
                             GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
           return true;
         }
@@ -554,7 +689,7 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
     else
     {
       UE_LOG(LogNEONMessageHandler, Error, TEXT("Unsupported output property type: %s"), *propertyName);
-      Callback->Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
+      Responder.Failure(static_cast<int>(ENEONErrorCode::UnsupportedPropertyType), GetErrorMessage(ENEONErrorCode::UnsupportedPropertyType));
       return true;
     }
   }
@@ -566,32 +701,59 @@ bool NEONMessageHandler::InvokeFunction(FString Name, TSharedPtr<FJsonObject> JS
 
   UE_LOG(LogNEONMessageHandler, Verbose, TEXT("Function result: %s"), *outputString);
 
-  Callback->Success(*outputString);
+  Responder.Success(outputString);
   return true;
 }
 
-bool NEONMessageHandler::InvokeEvent(FString Name, TSharedPtr<FJsonObject> JSON, CefRefPtr<Callback> Callback)
+bool NEONMessageHandler::InvokeEvent(FString Name, TSharedPtr<FJsonObject> JSON, NEONBridgeResponder &Responder)
 {
-  // Find the function by name
+  // Find the function by name. Only OnInvoke_* events are callable, not every UFUNCTION of the widget.
   UFunction *delegateFunction = _Widget->FindFunction(*Name);
-  if (!delegateFunction)
+  if (!FNEONBridgeBindings::IsEvent(delegateFunction))
   {
     UE_LOG(LogNEONMessageHandler, Error, TEXT("Event not found: %s"), *Name);
-    Callback->Failure(static_cast<int>(ENEONErrorCode::DelegateNotFound), GetErrorMessage(ENEONErrorCode::DelegateNotFound));
+    Responder.Failure(static_cast<int>(ENEONErrorCode::DelegateNotFound), GetErrorMessage(ENEONErrorCode::DelegateNotFound));
     return true;
   }
+  return InvokeEvent(delegateFunction, JSON, Responder);
+}
 
+bool NEONMessageHandler::InvokeEvent(UFunction *DelegateFunction, TSharedPtr<FJsonObject> JSON, NEONBridgeResponder &Responder)
+{
   // Prepare the parameters buffer and construct frame
-  uint8 *paramsBuffer = (uint8 *)FMemory_Alloca(delegateFunction->ParmsSize);
-  if (!BuildParamsBuffer(delegateFunction, JSON, paramsBuffer, Callback))
+  uint8 *paramsBuffer = (uint8 *)FMemory_Alloca(DelegateFunction->ParmsSize);
+  ON_SCOPE_EXIT { DestroyParamsBuffer(DelegateFunction, paramsBuffer); };
+  bool built = false;
+  {
+    SCOPE_CYCLE_COUNTER(STAT_NEON_QueryDecode);
+    CSV_SCOPED_TIMING_STAT(NEON, QueryDecode);
+    built = BuildParamsBuffer(DelegateFunction, JSON, paramsBuffer, Responder);
+  }
+  if (!built)
   {
     return true;
   }
 
-  UE_LOG(LogNEONMessageHandler, Verbose, TEXT("Parameters assembled, invoking event %s"), *Name);
-  _Widget->ProcessEvent(delegateFunction, paramsBuffer);
+  UE_LOG(LogNEONMessageHandler, Verbose, TEXT("Parameters assembled, invoking event %s"), *DelegateFunction->GetName());
+  {
+    SCOPE_CYCLE_COUNTER(STAT_NEON_ProcessEvent);
+    CSV_SCOPED_TIMING_STAT(NEON, ProcessEvent);
+    _Widget->ProcessEvent(DelegateFunction, paramsBuffer);
+  }
 
   // Events don't return values, so we just send an empty success response
-  Callback->Success("");
+  Responder.Success(FString());
   return true;
 }
+
+UFunction *NEONMessageHandler::FindDelegate(uint32 DelegateId)
+{
+  // The widget's class never changes, the table is built on the first query by id
+  if (!_DispatchTableBuilt)
+  {
+    FNEONBridgeBindings::BuildDispatchTable(_Widget->GetClass(), _DispatchTable);
+    _DispatchTableBuilt = true;
+  }
+  UFunction **function = _DispatchTable.Find(DelegateId);
+  return function ? *function : nullptr;
+}
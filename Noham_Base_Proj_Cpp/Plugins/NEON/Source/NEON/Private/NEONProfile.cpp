@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONProfile.cpp
+
+#include "NEONProfile.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+#include "NEONLogging.h"
+
+namespace
+{
+  const TCHAR *NEONConfigSection = TEXT("NEON");
+  const TCHAR *NEONProfileSectionPrefix = TEXT("NEON.Profile.");
+
+  // Built-in profiles. The config can override every field and add new profiles.
+  bool GetBuiltInProfile(const FString &ProfileName, FNEONProfile &OutProfile)
+  {
+    OutProfile = FNEONProfile();
+
+    if (ProfileName.Equals(TEXT("Default"), ESearchCase::IgnoreCase))
+    {
+      OutProfile.Name = TEXT("Default");
+      return true;
+    }
+    if (ProfileName.Equals(TEXT("LowMemory"), ESearchCase::IgnoreCase))
+    {
+      OutProfile.Name = TEXT("LowMemory");
+      OutProfile.RendererProcessLimit = 1;
+      OutProfile.bSiteIsolation = false;
+      OutProfile.JsHeapLimitMB = 128;
+      OutProfile.bGpuShaderDiskCache = false;
+      return true;
+    }
+    if (ProfileName.Equals(TEXT("LowLatency"), ESearchCase::IgnoreCase))
+    {
+      OutProfile.Name = TEXT("LowLatency");
+      OutProfile.bZeroCopy = true;
+      OutProfile.bBackgroundTimerThrottling = false;
+      return true;
+    }
+    if (ProfileName.Equals(TEXT("Deck"), ESearchCase::IgnoreCase))
+    {
+      OutProfile.Name = TEXT("Deck");
+      OutProfile.RendererProcessLimit = 1;
+      OutProfile.bSiteIsolation = false;
+      OutProfile.JsHeapLimitMB = 192;
+      OutProfile.bZeroCopy = true;
+      return true;
+    }
+    return false;
+  }
+}
+
+TArray<FString> FNEONProfile::GetProfileNames()
+{
+  TArray<FString> names = {TEXT("Default"), TEXT("LowMemory"), TEXT("LowLatency"), TEXT("Deck")};
+
+  if (!GConfig)
+  {
+    return names;
+  }
+
+  TArray<FString> sectionNames;
+  GConfig->GetSectionNames(GGameIni, sectionNames);
+  for (const FString &sectionName : sectionNames)
+  {
+    if (!sectionName.StartsWith(NEONProfileSectionPrefix))
+    {
+      continue;
+    }
+    FString profileName = sectionName.RightChop(FCString::Strlen(NEONProfileSectionPrefix));
+    if (!names.ContainsByPredicate([&profileName](const FString &Name)
+                                   { return Name.Equals(profileName, ESearchCase::IgnoreCase); }))
+    {
+      names.Add(profileName);
+    }
+  }
+  return names;
+}
+
+FString FNEONProfile::GetSelectedProfileName()
+{
+  FString profileName;
+  if (FParse::Value(FCommandLine::Get(), TEXT("NEONProfile="), profileName) && !profileName.IsEmpty())
+  {
+    return profileName;
+  }
+  if (GConfig && GConfig->GetString(NEONConfigSection, TEXT("Profile"), profileName, GGameIni) && !profileName.IsEmpty())
+  {
+    return profileName;
+  }
+  return TEXT("Default");
+}
+
+bool FNEONProfile::LoadProfile(const FString &ProfileName, FNEONProfile &OutProfile)
+{
+  bool found = GetBuiltInProfile(ProfileName, OutProfile);
+
+  FString sectionName = NEONProfileSectionPrefix + ProfileName;
+  if (GConfig && GConfig->DoesSectionExist(*sectionName, GGameIni))
+  {
+    if (!found)
+    {
+      OutProfile = FNEONProfile();
+      OutProfile.Name = ProfileName;
+      found = true;
+    }
+    GConfig->GetInt(*sectionName, TEXT("RendererProcessLimit"), OutProfile.RendererProcessLimit, GGameIni);
+    GConfig->GetBool(*sectionName, TEXT("bSiteIsolation"), OutProfile.bSiteIsolation, GGameIni);
+    GConfig->GetBool(*sectionName, TEXT("bGpuRasterization"), OutProfile.bGpuRasterization, GGameIni);
+    GConfig->GetBool(*sectionName, TEXT("bZeroCopy"), OutProfile.bZeroCopy, GGameIni);
+    GConfig->GetBool(*sectionName, TEXT("bGpuShaderDiskCache"), OutProfile.bGpuShaderDiskCache, GGameIni);
+    GConfig->GetInt(*sectionName, TEXT("JsHeapLimitMB"), OutProfile.JsHeapLimitMB, GGameIni);
+    GConfig->GetString(*sectionName, TEXT("JsFlags"), OutProfile.JsFlags, GGameIni);
+    GConfig->GetBool(*sectionName, TEXT("bBackgroundTimerThrottling"), OutProfile.bBackgroundTimerThrottling, GGameIni);
+    GConfig->GetBool(*sectionName, TEXT("bRouteAudio"), OutProfile.bRouteAudio, GGameIni);
+  }
+
+  if (!found)
+  {
+    UE_LOG(LogNEON, Warning, TEXT("Unknown NEON profile '%s'. Falling back to Default."), *ProfileName);
+    GetBuiltInProfile(TEXT("Default"), OutProfile);
+  }
+  return found;
+}
+
+FString FNEONProfile::ToString() const
+{
+  return FString::Printf(
+      TEXT("%s (RendererProcessLimit=%d, SiteIsolation=%d, GpuRasterization=%d, ZeroCopy=%d, GpuShaderDiskCache=%d, JsHeapLimitMB=%d, JsFlags='%s', BackgroundTimerThrottling=%d, RouteAudio=%d)"),
+      *Name, RendererProcessLimit, bSiteIsolation, bGpuRasterization, bZeroCopy, bGpuShaderDiskCache, JsHeapLimitMB, *JsFlags, bBackgroundTimerThrottling, bRouteAudio);
+}
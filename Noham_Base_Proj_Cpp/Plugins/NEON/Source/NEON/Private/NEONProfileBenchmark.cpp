@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONProfileBenchmark.cpp
+
+#include "NEONProfileBenchmark.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "CoreGlobals.h"
+
+#include "NEONLogging.h"
+#include "NEONProfile.h"
+#include "NEONResourceMonitor.h"
+
+static FAutoConsoleCommand GNEONProfileBenchmarkCommand(
+    TEXT("neon.profile.benchmark"),
+    TEXT("Relaunch the game once per NEON profile and record memory and frame cost. Usage: neon.profile.benchmark [Seconds] [Profile ...]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args)
+        {
+          float seconds = 30.0f;
+          TArray<FString> profileNames;
+          for (const FString &arg : Args)
+          {
+            if (arg.IsNumeric())
+            {
+              seconds = FCString::Atof(*arg);
+            }
+            else
+            {
+              profileNames.Add(arg);
+            }
+          }
+          if (profileNames.IsEmpty())
+          {
+            profileNames = FNEONProfile::GetProfileNames();
+          }
+          FNEONProfileBenchmark::Launch(profileNames, seconds);
+        }));
+
+namespace
+{
+  // The command line of this process without the benchmark switches
+  FString GetRelaunchArguments()
+  {
+    // FParse::Token keeps quoted arguments together but drops the quotes around a whole token
+    TArray<FString> tokens;
+    const TCHAR *stream = FCommandLine::Get();
+    FString token;
+    while (FParse::Token(stream, token, false))
+    {
+      if (token.StartsWith(TEXT("-NEONProfile")))
+      {
+        continue;
+      }
+      if (!token.Contains(TEXT("\"")) && token.Contains(TEXT(" ")))
+      {
+        token = FString::Printf(TEXT("\"%s\""), *token);
+      }
+      tokens.Add(token);
+    }
+    return FString::Join(tokens, TEXT(" "));
+  }
+
+  bool RelaunchWithProfile(const FString &ProfileName, const TArray<FString> &Queue, float Seconds)
+  {
+    FString arguments = FString::Printf(TEXT("%s -NEONProfile=%s -NEONProfileBenchmark=%.1f"), *GetRelaunchArguments(), *ProfileName, Seconds);
+    if (Queue.Num() > 0)
+    {
+      arguments += FString::Printf(TEXT(" -NEONProfileBenchmarkQueue=%s"), *FString::Join(Queue, TEXT("+")));
+    }
+
+    UE_LOG(LogNEON, Log, TEXT("Relaunching for NEON profile benchmark: %s"), *arguments);
+    FProcHandle procHandle = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *arguments, true, false, false, nullptr, 0, nullptr, nullptr);
+    if (!procHandle.IsValid())
+    {
+      UE_LOG(LogNEON, Error, TEXT("Failed to relaunch for NEON profile benchmark."));
+      return false;
+    }
+    FPlatformProcess::CloseProc(procHandle);
+    return true;
+  }
+}
+
+void FNEONProfileBenchmark::Launch(const TArray<FString> &ProfileNames, float Seconds)
+{
+  if (GIsEditor)
+  {
+    UE_LOG(LogNEON, Warning, TEXT("NEON profile benchmark relaunches the process and only runs in standalone games."));
+    return;
+  }
+  if (ProfileNames.IsEmpty())
+  {
+    UE_LOG(LogNEON, Warning, TEXT("NEON profile benchmark: no profiles given."));
+    return;
+  }
+
+  TArray<FString> queue = ProfileNames;
+  FString first = queue[0];
+  queue.RemoveAt(0);
+
+  if (RelaunchWithProfile(first, queue, Seconds))
+  {
+    RequestEngineExit(TEXT("NEON profile benchmark relaunch"));
+  }
+}
+
+void FNEONProfileBenchmark::StartFromCommandLine(const FString &ProfileName)
+{
+  float seconds = 0.0f;
+  if (!FParse::Value(FCommandLine::Get(), TEXT("NEONProfileBenchmark="), seconds) || seconds <= 0.0f)
+  {
+    return;
+  }
+
+  FString queue;
+  if (FParse::Value(FCommandLine::Get(), TEXT("NEONProfileBenchmarkQueue="), queue))
+  {
+    queue.ParseIntoArray(_Queue, TEXT("+"));
+  }
+
+  _ProfileName = ProfileName;
+  _Duration = seconds;
+  _Elapsed = 0.0f;
+  _IsRunning = true;
+
+  UE_LOG(LogNEON, Log, TEXT("NEON profile benchmark started for '%s' (%.1fs, %d queued)."), *_ProfileName, _Duration, _Queue.Num());
+}
+
+void FNEONProfileBenchmark::Tick(float DeltaSeconds, double PumpSeconds, const FNEONProcessTotals &Totals)
+{
+  if (!_IsRunning)
+  {
+    return;
+  }
+
+  _Elapsed += DeltaSeconds;
+  if (_Elapsed < _Warmup)
+  {
+    return;
+  }
+
+  _Frames++;
+  _FrameSeconds += DeltaSeconds;
+  _PumpSeconds += PumpSeconds;
+  _MaxPumpSeconds = FMath::Max(_MaxPumpSeconds, PumpSeconds);
+
+  // Nothing until the monitor has polled once
+  if (Totals.bValid)
+  {
+    _MemorySamples++;
+    _CefMemorySum += static_cast<double>(Totals.GetMemoryBytes());
+    _GpuProcessMemorySum += static_cast<double>(Totals.GpuProcessMemoryBytes);
+    _PeakCefMemory = FMath::Max(_PeakCefMemory, Totals.GetMemoryBytes());
+  }
+
+  if (_Elapsed >= _Warmup + _Duration)
+  {
+    Finish();
+  }
+}
+
+void FNEONProfileBenchmark::Finish()
+{
+  _IsRunning = false;
+
+  const double frames = FMath::Max<double>(_Frames, 1);
+  const double avgFrameMs = _FrameSeconds / frames * 1000.0;
+  const double avgPumpMs = _PumpSeconds / frames * 1000.0;
+  const double maxPumpMs = _MaxPumpSeconds * 1000.0;
+  const double memorySamples = FMath::Max<double>(_MemorySamples, 1);
+  const double avgCefMB = _CefMemorySum / memorySamples / (1024.0 * 1024.0);
+  const double avgGpuProcessMB = _GpuProcessMemorySum / memorySamples / (1024.0 * 1024.0);
+  const double peakCefMB = static_cast<double>(_PeakCefMemory) / (1024.0 * 1024.0);
+
+  FString csvPath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("NEON"), TEXT("ProfileBenchmark.csv"));
+  if (!FPaths::FileExists(csvPath))
+  {
+    FFileHelper::SaveStringToFile(TEXT("Timestamp,Profile,Frames,AvgFrameMs,AvgPumpMs,MaxPumpMs,AvgCefMemoryMB,PeakCefMemoryMB,AvgGpuProcessMemoryMB\n"), *csvPath);
+  }
+  FString row = FString::Printf(TEXT("%s,%s,%lld,%.3f,%.3f,%.3f,%.1f,%.1f,%.1f\n"),
+                                *FDateTime::Now().ToIso8601(), *_ProfileName, _Frames, avgFrameMs, avgPumpMs, maxPumpMs, avgCefMB, peakCefMB, avgGpuProcessMB);
+  FFileHelper::SaveStringToFile(row, *csvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+
+  if (_MemorySamples == 0)
+  {
+    UE_LOG(LogNEON, Warning, TEXT("NEON profile benchmark '%s': CefTaskManager reported no processes, memory columns are 0."), *_ProfileName);
+  }
+  UE_LOG(LogNEON, Log, TEXT("NEON profile benchmark '%s': frame %.3fms, pump %.3fms (max %.3fms), CEF memory %.1fMB (peak %.1fMB). Written to %s"),
+         *_ProfileName, avgFrameMs, avgPumpMs, maxPumpMs, avgCefMB, peakCefMB, *csvPath);
+
+  if (_Queue.Num() > 0)
+  {
+    FString next = _Queue[0];
+    _Queue.RemoveAt(0);
+    RelaunchWithProfile(next, _Queue, _Duration);
+  }
+  RequestEngineExit(TEXT("NEON profile benchmark finished"));
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONResourceMonitor.cpp
+
+#include "NEONResourceMonitor.h"
+
+#include "Windows/AllowWindowsPlatformTypes.h"
+THIRD_PARTY_INCLUDES_START
+#include "include/cef_task_manager.h"
+THIRD_PARTY_INCLUDES_END
+#include "Windows/HideWindowsPlatformTypes.h"
+
+#include "NEONLogging.h"
+#include "NEONStats.h"
+#include "UNEONWidget.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("CEF Processes"), STAT_NEON_Processes, STATGROUP_NEON);
+DECLARE_MEMORY_STAT(TEXT("Renderer Memory"), STAT_NEON_RendererMemory, STATGROUP_NEON);
+DECLARE_MEMORY_STAT(TEXT("GPU Process Memory"), STAT_NEON_GpuProcessMemory, STATGROUP_NEON);
+DECLARE_MEMORY_STAT(TEXT("Other Process Memory"), STAT_NEON_OtherProcessMemory, STATGROUP_NEON);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Renderer CPU %"), STAT_NEON_RendererCpu, STATGROUP_NEON);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GPU Process CPU %"), STAT_NEON_GpuProcessCpu, STATGROUP_NEON);
+
+void FNEONResourceMonitor::Start(float Interval)
+{
+  Stop();
+
+  if (Interval <= 0.0f)
+  {
+    UE_LOG(LogNEON, Log, TEXT("NEON resource monitor disabled."));
+    return;
+  }
+
+  _TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FNEONResourceMonitor::Tick), Interval);
+  UE_LOG(LogNEON, Log, TEXT("NEON resource monitor polling every %.1fs."), Interval);
+}
+
+void FNEONResourceMonitor::Stop()
+{
+  if (_TickerHandle.IsValid())
+  {
+    FTSTicker::GetCoreTicker().RemoveTicker(_TickerHandle);
+    _TickerHandle.Reset();
+  }
+}
+
+void FNEONResourceMonitor::RegisterWidget(UNEONWidget *Widget)
+{
+  _Widgets.AddUnique(Widget);
+}
+
+void FNEONResourceMonitor::UnregisterWidget(UNEONWidget *Widget)
+{
+  _Widgets.Remove(Widget);
+}
+
+bool FNEONResourceMonitor::Tick(float DeltaTime)
+{
+  _Widgets.RemoveAll([](const TWeakObjectPtr<UNEONWidget> &Widget)
+                     { return !Widget.IsValid(); });
+
+  CefRefPtr<CefTaskManager> taskManager = CefTaskManager::GetTaskManager();
+  if (!taskManager)
+  {
+    return true;
+  }
+
+  // Totals over all CEF processes
+  CefTaskManager::TaskIdList taskIds;
+  if (taskManager->GetTaskIdsList(taskIds))
+  {
+    int64 rendererMemory = 0;
+    int64 gpuMemory = 0;
+    int64 otherMemory = 0;
+    double rendererCpu = 0.0;
+    double gpuCpu = 0.0;
+
+    for (int64_t taskId : taskIds)
+    {
+      CefTaskInfo info;
+      if (!taskManager->GetTaskInfo(taskId, info))
+      {
+        continue;
+      }
+      const int64 memory = FMath::Max<int64>(info.memory, 0);
+      switch (info.type)
+      {
+      case CEF_TASK_TYPE_RENDERER:
+        rendererMemory += memory;
+        rendererCpu += info.cpu_usage;
+        break;
+      case CEF_TASK_TYPE_GPU:
+        gpuMemory += memory;
+        gpuCpu += info.cpu_usage;
+        break;
+      default:
+        otherMemory += memory;
+        break;
+      }
+    }
+
+    _Totals.bValid = true;
+    _Totals.Processes = static_cast<int32>(taskIds.size());
+    _Totals.RendererMemoryBytes = rendererMemory;
+    _Totals.GpuProcessMemoryBytes = gpuMemory;
+    _Totals.OtherMemoryBytes = otherMemory;
+
+    SET_DWORD_STAT(STAT_NEON_Processes, taskIds.size());
+    SET_MEMORY_STAT(STAT_NEON_RendererMemory, rendererMemory);
+    SET_MEMORY_STAT(STAT_NEON_GpuProcessMemory, gpuMemory);
+    SET_MEMORY_STAT(STAT_NEON_OtherProcessMemory, otherMemory);
+    SET_FLOAT_STAT(STAT_NEON_RendererCpu, rendererCpu);
+    SET_FLOAT_STAT(STAT_NEON_GpuProcessCpu, gpuCpu);
+  }
+
+  // Per browser. Copy the list, a widget may restart its browser from UpdateProcessStats.
+  TArray<TWeakObjectPtr<UNEONWidget>> widgets = _Widgets;
+  for (const TWeakObjectPtr<UNEONWidget> &widget : widgets)
+  {
+    CefBrowser *browser = widget.IsValid() ? widget->GetBrowser() : nullptr;
+    if (!browser)
+    {
+      continue;
+    }
+
+    FNEONProcessStats stats;
+    stats.BrowserId = browser->GetIdentifier();
+    stats.TaskId = taskManager->GetTaskIdForBrowserId(stats.BrowserId);
+
+    CefTaskInfo info;
+    if (stats.TaskId >= 0 && taskManager->GetTaskInfo(stats.TaskId, info))
+    {
+      stats.bValid = true;
+      stats.CpuUsage = static_cast<float>(info.cpu_usage);
+      stats.MemoryBytes = info.memory;
+      stats.GpuMemoryBytes = info.gpu_memory;
+    }
+
+    widget->UpdateProcessStats(stats);
+  }
+
+  return true;
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONStats.cpp
+#include "NEONStats.h"
+
+DEFINE_STAT(STAT_NEON_Pump);
+DEFINE_STAT(STAT_NEON_Paint);
+DEFINE_STAT(STAT_NEON_RenderThreadCopy);
+DEFINE_STAT(STAT_NEON_QueryDecode);
+DEFINE_STAT(STAT_NEON_ProcessEvent);
+DEFINE_STAT(STAT_NEON_ResponseEncode);
+
+DEFINE_STAT(STAT_NEON_Paints);
+DEFINE_STAT(STAT_NEON_BytesCopied);
+DEFINE_STAT(STAT_NEON_Queries);
+DEFINE_STAT(STAT_NEON_InvokeWebCalls);
+DEFINE_STAT(STAT_NEON_TopicPublishes);
+DEFINE_STAT(STAT_NEON_TopicDeliveries);
+DEFINE_STAT(STAT_NEON_TopicCoalesced);
+
+DEFINE_STAT(STAT_NEON_LiveSurfaces);
+DEFINE_STAT(STAT_NEON_FrozenSurfaces);
+
+DEFINE_STAT(STAT_NEON_InputLatencyP50);
+DEFINE_STAT(STAT_NEON_InputLatencyP95);
+DEFINE_STAT(STAT_NEON_InputLatencyP99);
+
+CSV_DEFINE_CATEGORY_MODULE(NEON_API, NEON, true);
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONSurfaceSubsystem.cpp
+
+#include "NEONSurfaceSubsystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/ConfigCacheIni.h"
+
+#include "NEONStats.h"
+#include "NEONWidgetComponent.h"
+
+void UNEONSurfaceSubsystem::Initialize(FSubsystemCollectionBase &Collection)
+{
+  Super::Initialize(Collection);
+
+  GConfig->GetInt(TEXT("NEON"), TEXT("MaxLiveSurfaces"), _MaxLiveSurfaces, GGameIni);
+}
+
+bool UNEONSurfaceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+  return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UNEONSurfaceSubsystem::GetStatId() const
+{
+  RETURN_QUICK_DECLARE_CYCLE_STAT(UNEONSurfaceSubsystem, STATGROUP_NEON);
+}
+
+void UNEONSurfaceSubsystem::RegisterSurface(UNEONWidgetComponent *Surface)
+{
+  _Surfaces.AddUnique(Surface);
+}
+
+void UNEONSurfaceSubsystem::UnregisterSurface(UNEONWidgetComponent *Surface)
+{
+  _Surfaces.Remove(Surface);
+}
+
+void UNEONSurfaceSubsystem::Tick(float DeltaTime)
+{
+  _Surfaces.RemoveAll([](const TWeakObjectPtr<UNEONWidgetComponent> &Surface)
+                      { return !Surface.IsValid(); });
+  if (_Surfaces.IsEmpty())
+  {
+    return;
+  }
+
+  APlayerController *playerController = GetWorld()->GetFirstPlayerController();
+  if (!playerController || !playerController->PlayerCameraManager)
+  {
+    return;
+  }
+
+  const FVector viewLocation = playerController->PlayerCameraManager->GetCameraLocation();
+  // FOV is horizontal, surfaces are measured by height. Close enough for LOD and independent of aspect ratio changes.
+  const float halfFOVTan = FMath::Tan(FMath::DegreesToRadians(playerController->PlayerCameraManager->GetFOVAngle() * 0.5f));
+  const double now = GetWorld()->GetRealTimeSeconds();
+
+  TArray<UNEONWidgetComponent *> ranked;
+  ranked.Reserve(_Surfaces.Num());
+  for (const TWeakObjectPtr<UNEONWidgetComponent> &surface : _Surfaces)
+  {
+    surface->UpdateVisibility(viewLocation, halfFOVTan, now);
+    ranked.Add(surface.Get());
+  }
+
+  ranked.Sort([](const UNEONWidgetComponent &A, const UNEONWidgetComponent &B)
+              {
+                if (A.IsOnScreen() != B.IsOnScreen())
+                  return A.IsOnScreen();
+                if (A._Priority != B._Priority)
+                  return A._Priority > B._Priority;
+                if (A.GetLastVisibleTime() != B.GetLastVisibleTime())
+                  return A.GetLastVisibleTime() > B.GetLastVisibleTime();
+                return A.GetScreenSize() > B.GetScreenSize(); });
+
+  int32 live = 0;
+  for (UNEONWidgetComponent *surface : ranked)
+  {
+    const bool isLive = surface->IsOnScreen() && live < _MaxLiveSurfaces;
+    surface->ApplyLOD(isLive, now);
+    live += isLive ? 1 : 0;
+  }
+
+  SET_DWORD_STAT(STAT_NEON_LiveSurfaces, live);
+  SET_DWORD_STAT(STAT_NEON_FrozenSurfaces, ranked.Num() - live);
+}
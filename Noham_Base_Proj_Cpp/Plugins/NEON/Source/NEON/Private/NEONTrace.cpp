@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONTrace.cpp
+
+#include "NEONTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
+
+#include "Windows/AllowWindowsPlatformTypes.h"
+THIRD_PARTY_INCLUDES_START
+#include "include/cef_trace.h"
+#include "include/base/cef_trace_event.h"
+THIRD_PARTY_INCLUDES_END
+#include "Windows/HideWindowsPlatformTypes.h"
+
+#include "NEON.h"
+#include "NEONLogging.h"
+
+// Rendering, compositing and scripting. "neon" carries the clock sync markers.
+static const TCHAR *NEONDefaultTraceCategories = TEXT("neon,blink,cc,gpu,viz,v8,toplevel,renderer.scheduler,devtools.timeline,disabled-by-default-devtools.timeline");
+
+static FAutoConsoleCommand GNEONTraceStartCommand(
+    TEXT("neon.trace.start"),
+    TEXT("Start a Chromium trace of all NEON browser processes. Usage: neon.trace.start [categories]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda(
+        [](const TArray<FString> &Args)
+        {
+          FNEONTrace::Start(Args.Num() > 0 ? FString::Join(Args, TEXT(",")) : FString());
+        }));
+
+static FAutoConsoleCommand GNEONTraceStopCommand(
+    TEXT("neon.trace.stop"),
+    TEXT("Stop the Chromium trace and write it next to the current .utrace."),
+    FConsoleCommandDelegate::CreateLambda(
+        []()
+        {
+          FNEONTrace::Stop();
+        }));
+
+bool FNEONTrace::_IsTracing = false;
+
+namespace
+{
+  class NEONTraceStartedCallback : public CefCompletionCallback
+  {
+  public:
+    void OnComplete() override
+    {
+      UE_LOG(LogNEON, Log, TEXT("NEON trace started."));
+      FNEONTrace::MarkClockSync();
+    }
+
+    IMPLEMENT_REFCOUNTING(NEONTraceStartedCallback);
+  };
+
+  class NEONTraceEndedCallback : public CefEndTracingCallback
+  {
+  public:
+    void OnEndTracingComplete(const CefString &TracingFile) override
+    {
+      UE_LOG(LogNEON, Log, TEXT("NEON trace written to %s"), TracingFile.ToWString().c_str());
+    }
+
+    IMPLEMENT_REFCOUNTING(NEONTraceEndedCallback);
+  };
+}
+
+bool FNEONTrace::Start(const FString &Categories)
+{
+  FNEONModule &NEONModule = FModuleManager::GetModuleChecked<FNEONModule>("NEON");
+  if (!NEONModule.IsInitialized())
+  {
+    UE_LOG(LogNEON, Warning, TEXT("Cannot start NEON trace, CEF is not initialized."));
+    return false;
+  }
+  if (_IsTracing)
+  {
+    UE_LOG(LogNEON, Warning, TEXT("NEON trace is already running."));
+    return false;
+  }
+
+  FString categories = Categories.IsEmpty() ? FString(NEONDefaultTraceCategories) : Categories;
+  if (!categories.Contains(TEXT("neon")))
+  {
+    categories += TEXT(",neon");
+  }
+
+  if (!CefBeginTracing(TCHAR_TO_UTF8(*categories), new NEONTraceStartedCallback()))
+  {
+    UE_LOG(LogNEON, Error, TEXT("CefBeginTracing failed. A previous trace may still be writing."));
+    return false;
+  }
+  _IsTracing = true;
+
+  UE_LOG(LogNEON, Log, TEXT("Starting NEON trace: %s"), *categories);
+  return true;
+}
+
+bool FNEONTrace::Stop()
+{
+  if (!_IsTracing)
+  {
+    UE_LOG(LogNEON, Warning, TEXT("NEON trace is not running."));
+    return false;
+  }
+
+  MarkClockSync();
+
+  FString traceFilePath = GetTraceFilePath();
+  _IsTracing = false;
+  if (!CefEndTracing(TCHAR_TO_UTF8(*traceFilePath), new NEONTraceEndedCallback()))
+  {
+    UE_LOG(LogNEON, Error, TEXT("CefEndTracing failed."));
+    return false;
+  }
+
+  UE_LOG(LogNEON, Log, TEXT("Stopping NEON trace. Writing to %s"), *traceFilePath);
+  return true;
+}
+
+void FNEONTrace::MarkClockSync()
+{
+  const int64 cefNow = CefNowFromSystemTraceTime();
+  const uint64 ueCycles = FPlatformTime::Cycles64();
+
+  TRACE_EVENT_INSTANT1("neon", "NEON.ClockSync", "ue_cycles", ueCycles);
+  TRACE_BOOKMARK(TEXT("NEON.ClockSync %lld"), cefNow);
+
+  UE_LOG(LogNEON, Log, TEXT("NEON clock sync: CEF %lldus = UE cycles %llu (%.3f cycles/us)"), cefNow, ueCycles, 1.0 / (FPlatformTime::GetSecondsPerCycle64() * 1000000.0));
+}
+
+FString FNEONTrace::GetTraceFilePath()
+{
+  const FString timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+
+  // Next to the .utrace if Insights is writing to a file
+  FString utracePath = FTraceAuxiliary::GetTraceDestinationString();
+  if (utracePath.EndsWith(TEXT(".utrace")))
+  {
+    return FPaths::ConvertRelativePathToFull(FPaths::ChangeExtension(utracePath, TEXT("")) + TEXT("_") + timestamp + TEXT(".neon.json"));
+  }
+
+  return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProfilingDir(), TEXT("NEON"), FString::Printf(TEXT("NEONTrace_%s.json"), *timestamp)));
+}
@@ -70,6 +70,52 @@ void NEONView::SetWidgetSize(const FVector2D &Size)
   _Widget->GetBrowser()->GetHost()->WasResized();
 }
 
+void NEONView::SetPopupVisible(bool Visible)
+{
+  _IsPopupVisible = Visible;
+  _HasPopupFrame = false;
+}
+
+void NEONView::SetPopupSize(const FVector2D &Size)
+{
+  if (_PopupTexture && _PopupSize == Size)
+  {
+    return;
+  }
+  _PopupSize = Size;
+  _HasPopupFrame = false;
+
+  if (Size.X < 1 || Size.Y < 1)
+  {
+    return;
+  }
+
+  // Kept while the popup is hidden, dropdowns tend to reopen with the same size
+  _PopupTexture = UTexture2D::CreateTransient(
+      static_cast<int>(Size.X),
+      static_cast<int>(Size.Y),
+      PF_B8G8R8A8);
+  if (!_PopupTexture)
+  {
+    UE_LOG(LogNEONView, Error, TEXT("NEONView::SetPopupSize: Failed to create popup texture."));
+    return;
+  }
+  _PopupTexture->UpdateResource();
+
+  _Widget->GetPopupBrush().SetResourceObject(_PopupTexture);
+  _Widget->GetPopupBrush().ImageSize = FVector2D(Size.X, Size.Y);
+}
+
+FRHITexture *NEONView::GetPopupRHITexture()
+{
+  FTextureResource *popupTextureResource = _PopupTexture ? _PopupTexture->GetResource() : nullptr;
+  if (!popupTextureResource || !popupTextureResource->TextureRHI)
+  {
+    return nullptr;
+  }
+  return popupTextureResource->TextureRHI->GetTexture2D();
+}
+
 FRHITexture *NEONView::GetDynamicRHITexture()
 {
   if (!_DynamicTexture)
@@ -18,6 +18,7 @@
 #include "Blueprint/WidgetLayoutLibrary.h"
 
 #include "NEONLogging.h"
+#include "NEONStats.h"
 #include "UNEONWidget.h"
 
 bool NEONView_11::InitializeView(UNEONWidget *Widget)
@@ -121,7 +122,6 @@ void NEONView_11::DestroyView()
   _D3D11Context.Reset();
   _D3D11Context1.Reset();
   _D3D11RHI = nullptr;
-  _SharedResourcePopup_D3D11.Reset();
 }
 
 void NEONView_11::OnAcceleratedPaint_View(HANDLE SharedHandle)
@@ -157,9 +157,9 @@ void NEONView_11::OnAcceleratedPaint_View(HANDLE SharedHandle)
 
   if (sharedDesc.Width != static_cast<int>(_WidgetSize.X) || sharedDesc.Height != static_cast<int>(_WidgetSize.Y))
   {
-    UE_LOG(LogNEONView, Log, TEXT("WidgetSize: %d, %d"), static_cast<int>(_WidgetSize.X), static_cast<int>(_WidgetSize.Y));
-    UE_LOG(LogNEONView, Log, TEXT("Shared: %d, %d"), sharedDesc.Width, sharedDesc.Height);
-    UE_LOG(LogNEONView, Log, TEXT("Dimensions do not match. Invalidating and waiting for next frame"));
+    // Happens on every frame during a resize, keep it out of the log
+    UE_LOG(LogNEONView, Verbose, TEXT("Dimensions do not match (widget %dx%d, shared %dx%d). Invalidating and waiting for next frame"),
+           static_cast<int>(_WidgetSize.X), static_cast<int>(_WidgetSize.Y), static_cast<int>(sharedDesc.Width), static_cast<int>(sharedDesc.Height));
     _Widget->InvalidateBrowser();
     return;
   }
@@ -173,41 +173,30 @@ void NEONView_11::OnAcceleratedPaint_View(HANDLE SharedHandle)
   }
   ComPtr<ID3D11Texture2D> dynamicTexture = static_cast<ID3D11Texture2D *>(dynamicRHITexture->GetNativeResource());
 
+  // B8G8R8A8
+  const uint32 bytesCopied = sharedDesc.Width * sharedDesc.Height * 4;
+  INC_DWORD_STAT_BY(STAT_NEON_BytesCopied, bytesCopied);
+  CSV_CUSTOM_STAT(NEON, BytesCopied, static_cast<int32>(bytesCopied), ECsvCustomStatOp::Accumulate);
+
   // Copy from the shared resource into our dynamic texture
   ENQUEUE_RENDER_COMMAND(CopyExternalTextureToUTexture)
   (
       [this, dynamicTexture, sharedTexture](FRHICommandListImmediate &RHICmdList) mutable
       {
-        _D3D11Context1->CopyResource(dynamicTexture.Get(), sharedTexture.Get());
-
-        // If popup visible, also copy the popup texture
-        if (_IsPopupVisible && _SharedResourcePopup_D3D11)
-        {
-          D3D11_BOX srcRegion;
-          srcRegion.left = 0;
-          srcRegion.top = 0;
-          srcRegion.front = 0;
-          srcRegion.right = static_cast<UINT>(_PopupSize.X);
-          srcRegion.bottom = static_cast<UINT>(_PopupSize.Y);
-          srcRegion.back = 1;
-
-          _D3D11Context1->CopySubresourceRegion(
-              dynamicTexture.Get(),
-              0,
-              static_cast<UINT>(_PopupPosition.X),
-              static_cast<UINT>(_PopupPosition.Y),
-              0,
-              _SharedResourcePopup_D3D11.Get(),
-              0,
-              &srcRegion);
-        }
+        SCOPE_CYCLE_COUNTER(STAT_NEON_RenderThreadCopy);
+        CSV_SCOPED_TIMING_STAT(NEON, RenderThreadCopy);
 
+        _D3D11Context1->CopyResource(dynamicTexture.Get(), sharedTexture.Get());
         _D3D11Context1->Flush();
       });
 }
 
 void NEONView_11::OnAcceleratedPaint_View_Popup(HANDLE SharedHandle)
 {
+  if (!_IsInUse || !_Widget)
+  {
+    return;
+  }
   if (!_IsPopupVisible)
   {
     UE_LOG(LogNEONView, Error, TEXT("Popup is not visible (D3D11)."));
@@ -219,26 +208,49 @@ void NEONView_11::OnAcceleratedPaint_View_Popup(HANDLE SharedHandle)
     return;
   }
 
-  // Store the popup resource pointer
-  HRESULT hr = _D3D11Device1->OpenSharedResource1(SharedHandle, __uuidof(ID3D11Texture2D), (void **)&_SharedResourcePopup_D3D11);
+  ComPtr<ID3D11Texture2D> sharedTexture;
+  HRESULT hr = _D3D11Device1->OpenSharedResource1(SharedHandle, __uuidof(ID3D11Texture2D), (void **)&sharedTexture);
   if (FAILED(hr))
   {
     UE_LOG(LogNEONView, Error, TEXT("Failed to open shared popup handle (D3D11) with HRESULT: 0x%08X"), hr);
     return;
   }
 
-  if (!_Widget)
+  FRHITexture *popupRHITexture = GetPopupRHITexture();
+  if (!popupRHITexture)
   {
+    // The popup texture was just (re)created, ask for the popup again instead of the whole view
+    _Widget->GetBrowser()->GetHost()->Invalidate(PET_POPUP);
     return;
   }
-  _Widget->InvalidateBrowser();
-}
+  ComPtr<ID3D11Texture2D> popupTexture = static_cast<ID3D11Texture2D *>(popupRHITexture->GetNativeResource());
 
-void NEONView_11::SetPopupVisible(bool Visible)
-{
-  _IsPopupVisible = Visible;
-  if (!Visible)
-  {
-    _SharedResourcePopup_D3D11.Reset();
-  }
+  D3D11_TEXTURE2D_DESC sharedDesc;
+  sharedTexture->GetDesc(&sharedDesc);
+  const UINT width = FMath::Min(sharedDesc.Width, static_cast<UINT>(_PopupSize.X));
+  const UINT height = FMath::Min(sharedDesc.Height, static_cast<UINT>(_PopupSize.Y));
+
+  const uint32 bytesCopied = width * height * 4;
+  INC_DWORD_STAT_BY(STAT_NEON_BytesCopied, bytesCopied);
+  CSV_CUSTOM_STAT(NEON, BytesCopied, static_cast<int32>(bytesCopied), ECsvCustomStatOp::Accumulate);
+
+  ENQUEUE_RENDER_COMMAND(CopyExternalPopupToUTexture)
+  (
+      [this, popupTexture, sharedTexture, width, height](FRHICommandListImmediate &RHICmdList) mutable
+      {
+        SCOPE_CYCLE_COUNTER(STAT_NEON_RenderThreadCopy);
+        CSV_SCOPED_TIMING_STAT(NEON, RenderThreadCopy);
+
+        D3D11_BOX srcRegion;
+        srcRegion.left = 0;
+        srcRegion.top = 0;
+        srcRegion.front = 0;
+        srcRegion.right = width;
+        srcRegion.bottom = height;
+        srcRegion.back = 1;
+
+        _D3D11Context1->CopySubresourceRegion(popupTexture.Get(), 0, 0, 0, 0, sharedTexture.Get(), 0, &srcRegion);
+        _D3D11Context1->Flush();
+      });
+  _HasPopupFrame = true;
 }
\ No newline at end of file
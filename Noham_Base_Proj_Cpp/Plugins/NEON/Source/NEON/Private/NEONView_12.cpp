@@ -18,6 +18,7 @@
 #include "Blueprint/WidgetLayoutLibrary.h"
 
 #include "NEONLogging.h"
+#include "NEONStats.h"
 #include "UNEONWidget.h"
 
 bool NEONView_12::InitializeView(UNEONWidget *Widget)
@@ -83,7 +84,6 @@ void NEONView_12::DestroyView()
   _D3D12Device.Reset();
   _D3D12CommandQueue.Reset();
   _D3D12RHI = nullptr;
-  _SharedResourcePopup_D3D12.Reset();
 }
 
 void NEONView_12::OnAcceleratedPaint_View(HANDLE SharedHandle)
@@ -126,19 +126,27 @@ void NEONView_12::OnAcceleratedPaint_View(HANDLE SharedHandle)
   D3D12_RESOURCE_DESC sharedDesc = sharedResource->GetDesc();
   if (sharedDesc.Width != static_cast<int>(_WidgetSize.X) || sharedDesc.Height != static_cast<int>(_WidgetSize.Y))
   {
-    UE_LOG(LogNEONView, Log, TEXT("WidgetSize: %d, %d"), static_cast<int>(_WidgetSize.X), static_cast<int>(_WidgetSize.Y));
-    UE_LOG(LogNEONView, Log, TEXT("Shared: %d, %d"), sharedDesc.Width, sharedDesc.Height);
-    UE_LOG(LogNEONView, Log, TEXT("Dimensions do not match. Invalidating and waiting for next frame"));
+    // Happens on every frame during a resize, keep it out of the log
+    UE_LOG(LogNEONView, Verbose, TEXT("Dimensions do not match (widget %dx%d, shared %dx%d). Invalidating and waiting for next frame"),
+           static_cast<int>(_WidgetSize.X), static_cast<int>(_WidgetSize.Y), static_cast<int>(sharedDesc.Width), static_cast<int>(sharedDesc.Height));
     _Widget->InvalidateBrowser();
     return;
   }
 
+  // B8G8R8A8
+  const uint32 bytesCopied = static_cast<uint32>(sharedDesc.Width * sharedDesc.Height * 4);
+  INC_DWORD_STAT_BY(STAT_NEON_BytesCopied, bytesCopied);
+  CSV_CUSTOM_STAT(NEON, BytesCopied, static_cast<int32>(bytesCopied), ECsvCustomStatOp::Accumulate);
+
   // Use a render command to copy from the shared texture into dynamic texture
   UE_LOG(LogNEONView, Verbose, TEXT("About to start render (D3D12)."));
   ENQUEUE_RENDER_COMMAND(CopyExternalTextureToUTexture)
   (
       [this, sharedResource, dynamicRHITexture, sharedDesc, SharedHandle](FRHICommandListImmediate &RHICmdList) mutable
       {
+        SCOPE_CYCLE_COUNTER(STAT_NEON_RenderThreadCopy);
+        CSV_SCOPED_TIMING_STAT(NEON, RenderThreadCopy);
+
         const EPixelFormat format = PF_B8G8R8A8;
         const ETextureCreateFlags texCreateFlags = TexCreate_ShaderResource;
         const FClearValueBinding clearValueBinding = FClearValueBinding::None;
@@ -159,27 +167,6 @@ void NEONView_12::OnAcceleratedPaint_View(HANDLE SharedHandle)
         // Copy main texture
         AddCopyTexturePass(graphBuilder, sourceRDGTexture, destRDGTexture);
 
-        // If popup is visible, also copy the popup
-        if (_IsPopupVisible && _SharedResourcePopup_D3D12)
-        {
-          UE_LOG(LogNEONView, Verbose, TEXT("Popup is visible. Rendering in main (D3D12)."));
-
-          FRHITexture *sharedTexturePopupRHI = _D3D12RHI->RHICreateTexture2DFromResource(format, texCreateFlags, clearValueBinding, _SharedResourcePopup_D3D12.Get());
-          if (!sharedTexturePopupRHI)
-          {
-            UE_LOG(LogNEONView, Error, TEXT("Failed to create sharedTexturePopupRHI (D3D12)."));
-            return;
-          }
-
-          FRHICopyTextureInfo copyInfo;
-          copyInfo.Size = FIntVector(_PopupSize.X, _PopupSize.Y, 1);
-          copyInfo.SourcePosition = FIntVector(0, 0, 0);
-          copyInfo.DestPosition = FIntVector(_PopupPosition.X, _PopupPosition.Y, 0);
-
-          FRDGTextureRef sourceRDGTexturePopup = graphBuilder.RegisterExternalTexture(CreateRenderTarget(sharedTexturePopupRHI, TEXT("SourceRDGTexturePopup_D3D12")));
-          AddCopyTexturePass(graphBuilder, sourceRDGTexturePopup, destRDGTexture, copyInfo);
-        }
-
         graphBuilder.Execute();
         sharedResource.Reset();
         //
@@ -188,6 +175,10 @@ void NEONView_12::OnAcceleratedPaint_View(HANDLE SharedHandle)
 
 void NEONView_12::OnAcceleratedPaint_View_Popup(HANDLE SharedHandle)
 {
+  if (!_IsInUse || !_Widget)
+  {
+    return;
+  }
   if (!_IsPopupVisible)
   {
     UE_LOG(LogNEONView, Error, TEXT("Popup is not visible (D3D12)."));
@@ -199,27 +190,55 @@ void NEONView_12::OnAcceleratedPaint_View_Popup(HANDLE SharedHandle)
     return;
   }
 
-  // Store the popup texture for usage in the main paint
-  HRESULT hr = _D3D12Device->OpenSharedHandle(SharedHandle, IID_PPV_ARGS(&_SharedResourcePopup_D3D12));
-  if (FAILED(hr))
+  FRHITexture *popupRHITexture = GetPopupRHITexture();
+  if (!popupRHITexture)
   {
-    UE_LOG(LogNEONView, Error, TEXT("Failed to open shared handle for popup (D3D12). HRESULT: 0x%08X"), hr);
+    // The popup texture was just (re)created, ask for the popup again instead of the whole view
+    _Widget->GetBrowser()->GetHost()->Invalidate(PET_POPUP);
     return;
   }
 
-  if (!_Widget)
+  ComPtr<ID3D12Resource> sharedResource;
+  HRESULT hr = _D3D12Device->OpenSharedHandle(SharedHandle, IID_PPV_ARGS(&sharedResource));
+  if (FAILED(hr))
   {
+    UE_LOG(LogNEONView, Error, TEXT("Failed to open shared handle for popup (D3D12). HRESULT: 0x%08X"), hr);
     return;
   }
-  _Widget->InvalidateBrowser();
-}
 
-void NEONView_12::SetPopupVisible(bool Visible)
-{
-  UE_LOG(LogNEONView, Log, TEXT("NEONView_12::SetPopupVisible: %d"), Visible);
-  _IsPopupVisible = Visible;
-  if (!Visible)
-  {
-    _SharedResourcePopup_D3D12.Reset();
-  }
+  D3D12_RESOURCE_DESC sharedDesc = sharedResource->GetDesc();
+  const int32 width = FMath::Min(static_cast<int32>(sharedDesc.Width), static_cast<int32>(_PopupSize.X));
+  const int32 height = FMath::Min(static_cast<int32>(sharedDesc.Height), static_cast<int32>(_PopupSize.Y));
+
+  const uint32 bytesCopied = static_cast<uint32>(width * height * 4);
+  INC_DWORD_STAT_BY(STAT_NEON_BytesCopied, bytesCopied);
+  CSV_CUSTOM_STAT(NEON, BytesCopied, static_cast<int32>(bytesCopied), ECsvCustomStatOp::Accumulate);
+
+  ENQUEUE_RENDER_COMMAND(CopyExternalPopupToUTexture)
+  (
+      [this, sharedResource, popupRHITexture, width, height](FRHICommandListImmediate &RHICmdList) mutable
+      {
+        SCOPE_CYCLE_COUNTER(STAT_NEON_RenderThreadCopy);
+        CSV_SCOPED_TIMING_STAT(NEON, RenderThreadCopy);
+
+        FRHITexture *sharedRHITexture = _D3D12RHI->RHICreateTexture2DFromResource(PF_B8G8R8A8, TexCreate_ShaderResource, FClearValueBinding::None, sharedResource.Get());
+        if (!sharedRHITexture)
+        {
+          UE_LOG(LogNEONView, Error, TEXT("Failed to create popup sharedRHITexture (D3D12)."));
+          return;
+        }
+
+        FRDGBuilder graphBuilder(RHICmdList);
+
+        FRDGTextureRef sourceRDGTexture = graphBuilder.RegisterExternalTexture(CreateRenderTarget(sharedRHITexture, TEXT("SourceRDGTexturePopup_D3D12")));
+        FRDGTextureRef destRDGTexture = graphBuilder.RegisterExternalTexture(CreateRenderTarget(popupRHITexture, TEXT("DestRDGTexturePopup_D3D12")));
+
+        FRHICopyTextureInfo copyInfo;
+        copyInfo.Size = FIntVector(width, height, 1);
+        AddCopyTexturePass(graphBuilder, sourceRDGTexture, destRDGTexture, copyInfo);
+
+        graphBuilder.Execute();
+        sharedResource.Reset();
+      });
+  _HasPopupFrame = true;
 }
\ No newline at end of file
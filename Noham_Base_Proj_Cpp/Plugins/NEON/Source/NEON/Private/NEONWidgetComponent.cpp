@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONWidgetComponent.cpp
+
+#include "NEONWidgetComponent.h"
+#include "Engine/World.h"
+
+#include "NEONSurfaceSubsystem.h"
+#include "UNEONWidget.h"
+
+namespace
+{
+  // Render scales are quantized, every change recreates the texture
+  constexpr float NEONRenderScaleStep = 0.25f;
+
+  // Going down in resolution waits this long, going up is immediate
+  constexpr double NEONRenderScaleDownDelay = 1.0;
+}
+
+UNEONWidgetComponent::UNEONWidgetComponent(const FObjectInitializer &ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+  SetWidgetSpace(EWidgetSpace::World);
+}
+
+UNEONWidget *UNEONWidgetComponent::GetNEONWidget() const
+{
+  return Cast<UNEONWidget>(GetWidget());
+}
+
+void UNEONWidgetComponent::BeginPlay()
+{
+  Super::BeginPlay();
+
+  if (UNEONSurfaceSubsystem *subsystem = GetWorld()->GetSubsystem<UNEONSurfaceSubsystem>())
+  {
+    subsystem->RegisterSurface(this);
+  }
+}
+
+void UNEONWidgetComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+  if (UNEONSurfaceSubsystem *subsystem = GetWorld()->GetSubsystem<UNEONSurfaceSubsystem>())
+  {
+    subsystem->UnregisterSurface(this);
+  }
+
+  Super::EndPlay(EndPlayReason);
+}
+
+void UNEONWidgetComponent::UpdateVisibility(const FVector &ViewLocation, float ViewHalfFOVTan, double Now)
+{
+  const float worldHeight = GetDrawSize().Y * GetComponentScale().Z;
+  const float distance = FMath::Max(FVector::Dist(ViewLocation, GetComponentLocation()), 1.0f);
+  _ScreenSize = worldHeight / (2.0f * distance * FMath::Max(ViewHalfFOVTan, KINDA_SMALL_NUMBER));
+
+  // WasRecentlyRendered covers frustum and occlusion culling
+  const bool rendered = IsVisible() && WasRecentlyRendered(0.1f);
+  if (rendered)
+  {
+    _LastVisibleTime = Now;
+  }
+  _IsOnScreen = _LastVisibleTime >= 0.0 && Now - _LastVisibleTime <= _FreezeDelay;
+}
+
+void UNEONWidgetComponent::ApplyLOD(bool bLive, double Now)
+{
+  UNEONWidget *widget = GetNEONWidget();
+  if (!widget)
+  {
+    return;
+  }
+
+  const float detail = FMath::Clamp(_ScreenSize / _FullDetailScreenSize, 0.0f, 1.0f);
+
+  const float targetScale = FMath::Clamp(FMath::CeilToFloat(detail / NEONRenderScaleStep) * NEONRenderScaleStep, _MinRenderScale, 1.0f);
+  if (targetScale > _RenderScale || (targetScale < _RenderScale && Now - _LastRenderScaleChange >= NEONRenderScaleDownDelay))
+  {
+    _RenderScale = targetScale;
+  }
+  if (targetScale >= _RenderScale)
+  {
+    _LastRenderScaleChange = Now;
+  }
+
+  // Steps of 5 so small camera movements don't reconfigure the browser every frame
+  const int32 maxFrameRate = FMath::Max(widget->_MaxFPS, _MinFrameRate);
+  const int32 frameRate = FMath::Clamp(FMath::RoundToInt(FMath::Lerp(static_cast<float>(_MinFrameRate), static_cast<float>(maxFrameRate), detail) / 5.0f) * 5, _MinFrameRate, maxFrameRate);
+
+  widget->SetLOD(_RenderScale, frameRate, !bLive);
+
+  // Frozen surfaces also skip redrawing the widget into the render target
+  SetManuallyRedraw(!bLive);
+  SetRedrawTime(bLive ? 1.0f / frameRate : 0.0f);
+}
@@ -19,13 +19,22 @@
 
 #include "NEON.h"
 #include "NEONMessageHandler.h"
+#include "NEONAudioComponent.h"
+#include "NEONBridgeRecorder.h"
 
 #include "NEONView_11.h"
 #include "NEONView_12.h"
+#include "NEONView_Null.h"
 #include "NEONLogging.h"
+#include "NEONStats.h"
 
 using Microsoft::WRL::ComPtr;
 
+// Frames without tick or paint after which topic messages are coalesced instead of queued
+static constexpr uint64 NEONTopicShownFrames = 2;
+// Queued topic messages of a shown widget beyond which it coalesces as well, e.g. while the game thread stalls
+static constexpr int32 NEONMaxQueuedTopicMessages = 256;
+
 void UNEONWidget::NativeConstruct()
 {
   Super::NativeConstruct();
@@ -50,6 +59,24 @@ void UNEONWidget::NativeConstruct()
       //
   );
 
+  FNEONModule &NEONModule = FModuleManager::GetModuleChecked<FNEONModule>("NEON");
+
+  for (const FName &topic : _Topics)
+  {
+    NEONModule.GetBroadcast().Subscribe(this, topic);
+  }
+
+  // Headless: no browser, the message handler is driven through InvokeUnreal
+  if (NEONModule.IsHeadless())
+  {
+    UE_LOG(LogNEONWidget, Log, TEXT("NEON is headless. Creating widget without browser."));
+    _IsHeadless = true;
+    _View = new NEONView_Null();
+    _View->InitializeView(this);
+    _MessageHandler = new NEONMessageHandler(this);
+    return;
+  }
+
   // Attempt to create the appropriate NEONView
   ERHIInterfaceType currentRHI = RHIGetInterfaceType();
   bool bCreatedView = false;
@@ -86,13 +113,11 @@ void UNEONWidget::NativeConstruct()
     return;
   }
 
-  FNEONModule &NEONModule = FModuleManager::GetModuleChecked<FNEONModule>("NEON");
-
   // Create the render handler and client
   UE_LOG(LogNEONWidget, Log, TEXT("Creating Message Handler"));
-  NEONMessageHandler *messageHandler = new NEONMessageHandler(this);
+  _MessageHandler = new NEONMessageHandler(this);
   UE_LOG(LogNEONWidget, Log, TEXT("Creating NEONClient"));
-  _Client = new NEONClient(messageHandler);
+  _Client = new NEONClient(_MessageHandler);
 
   CreateBrowser();
 }
@@ -100,12 +125,47 @@ void UNEONWidget::NativeConstruct()
 void UNEONWidget::SetMaxFPS(int MaxFPS)
 {
   _MaxFPS = MaxFPS;
+  if (_IsHeadless)
+    return;
   if (_Browser && _Browser->GetHost())
-    _Browser->GetHost()->SetWindowlessFrameRate(_MaxFPS);
+    ApplyFrameRate();
   else
     UE_LOG(LogNEONWidget, Error, TEXT("Browser or host is null. Cannot set max FPS."));
 }
 
+void UNEONWidget::ApplyFrameRate()
+{
+  const int32 frameRate = _LODFrameRate > 0 ? FMath::Min(_MaxFPS, _LODFrameRate) : _MaxFPS;
+  _Browser->GetHost()->SetWindowlessFrameRate(FMath::Max(frameRate, 1));
+}
+
+void UNEONWidget::SetLOD(float RenderScale, int32 FrameRate, bool bFrozen)
+{
+  // The render scale is picked up in NativeTick together with the widget size
+  _RenderScale = FMath::Clamp(RenderScale, 0.1f, 1.0f);
+
+  if (_IsHeadless || !_Browser)
+  {
+    _LODFrameRate = FrameRate;
+    _IsFrozen = bFrozen;
+    return;
+  }
+
+  if (_LODFrameRate != FrameRate)
+  {
+    _LODFrameRate = FrameRate;
+    ApplyFrameRate();
+  }
+
+  if (_IsFrozen != bFrozen)
+  {
+    _IsFrozen = bFrozen;
+    _Browser->GetHost()->WasHidden(_IsFrozen);
+    if (!_IsFrozen)
+      _Browser->GetHost()->Invalidate(PET_VIEW);
+  }
+}
+
 void UNEONWidget::SetProcessingTime(float ProcessingTime)
 {
   // Get module, set processing time
@@ -118,6 +178,35 @@ int UNEONWidget::GetFPS()
   return _FPS;
 }
 
+void UNEONWidget::UpdateProcessStats(const FNEONProcessStats &Stats)
+{
+  _ProcessStats = Stats;
+
+  if (_RendererMemoryBudgetMB <= 0 || !Stats.bValid)
+  {
+    return;
+  }
+
+  // Only fire once per crossing, not on every poll while over budget
+  const bool overBudget = Stats.GetMemoryMB() > _RendererMemoryBudgetMB;
+  if (!overBudget || _IsOverBudget)
+  {
+    _IsOverBudget = overBudget;
+    return;
+  }
+  _IsOverBudget = true;
+
+  UE_LOG(LogNEONWidget, Warning, TEXT("Renderer for browser %d is over budget: %.1fMB > %dMB (CPU %.1f%%)."),
+         Stats.BrowserId, Stats.GetMemoryMB(), _RendererMemoryBudgetMB, Stats.CpuUsage);
+  OnRendererOverBudget(Stats);
+
+  if (_RecycleOverBudget)
+  {
+    UE_LOG(LogNEONWidget, Warning, TEXT("Recycling browser %d."), Stats.BrowserId);
+    RestartBrowser();
+  }
+}
+
 void UNEONWidget::CreateBrowser()
 {
   // Create the browser
@@ -188,7 +277,13 @@ void UNEONWidget::CreateBrowser()
 #endif
 
   _Client->SetWidget(this);
-  _Browser->GetHost()->SetWindowlessFrameRate(_MaxFPS);
+  ApplyFrameRate();
+  if (_IsFrozen)
+    _Browser->GetHost()->WasHidden(true);
+
+  _ProcessStats = FNEONProcessStats();
+  _IsOverBudget = false;
+  FModuleManager::GetModuleChecked<FNEONModule>("NEON").GetResourceMonitor().RegisterWidget(this);
 
   OnBrowserCreated();
 }
@@ -197,16 +292,29 @@ void UNEONWidget::NativeTick(const FGeometry &MyGeometry, float InDeltaTime)
 {
   Super::NativeTick(MyGeometry, InDeltaTime);
 
+  _LastShownFrame = GFrameCounter;
+  FlushTopicMessages();
+
   if (!_Browser || !_View)
   {
     return;
   }
 
   _ScaleFactor = UWidgetLayoutLibrary::GetViewportScale(GEngine->GameViewport->GetWorld());
-  _View->SetWidgetSize(MyGeometry.GetLocalSize() * _ScaleFactor);
+  if (_Client->GetRenderScale() != _RenderScale)
+  {
+    _Client->SetRenderScale(_RenderScale);
+    _Browser->GetHost()->NotifyScreenInfoChanged();
+  }
+  _View->SetWidgetSize(MyGeometry.GetLocalSize() * _ScaleFactor * _RenderScale);
 
   if (_ExternalBeginFrame)
     _Browser->GetHost()->SendExternalBeginFrame();
+
+  UpdateAudio();
+
+  if (_MeasureInputLatency)
+    _LatencyProbe.Publish(GetName());
 }
 
 void UNEONWidget::NativeDestruct()
@@ -215,6 +323,13 @@ void UNEONWidget::NativeDestruct()
 
   UE_LOG(LogNEONWidget, Log, TEXT("Destructing NEON Widget"));
 
+  FModuleManager::GetModuleChecked<FNEONModule>("NEON").GetResourceMonitor().UnregisterWidget(this);
+  FModuleManager::GetModuleChecked<FNEONModule>("NEON").GetBroadcast().UnsubscribeAll(this);
+  _TopicQueue.Reset();
+  _LatestTopicMessages.Reset();
+
+  DestroyAudio();
+
   if (_View)
   {
     _View->DestroyView();
@@ -242,12 +357,27 @@ void UNEONWidget::NativeDestruct()
     _Client->Stop();
     _Client = nullptr;
   }
+  else if (_MessageHandler)
+  {
+    delete _MessageHandler;
+  }
+  _MessageHandler = nullptr;
 
   GetWorld()->GetTimerManager().ClearTimer(_FPSTimerHandle);
+  GetWorld()->GetTimerManager().ClearTimer(_UnresponsiveTimerHandle);
+  GetWorld()->GetTimerManager().ClearTimer(_RecoveryTimerHandle);
+  _RecoveryAttempts = 0;
+  _UnresponsiveCallback = nullptr;
 }
 
 void UNEONWidget::RestartBrowser()
 {
+  // Destructed: the client is gone until the widget is constructed again
+  if (_IsHeadless || !_Client)
+  {
+    return;
+  }
+
   if (_Browser)
   {
     _Browser->GetHost()->CloseBrowser(true);
@@ -257,6 +387,160 @@ void UNEONWidget::RestartBrowser()
   CreateBrowser();
 }
 
+void UNEONWidget::RecoverBrowser(const FString &Reason)
+{
+  if (!_AutoRecover || _IsHeadless)
+  {
+    return;
+  }
+
+  FTimerManager &timerManager = GetWorld()->GetTimerManager();
+  if (timerManager.TimerExists(_RecoveryTimerHandle))
+  {
+    // A restart is already scheduled
+    return;
+  }
+
+  // A page that fails right after loading would otherwise be restarted in a tight loop. Consecutive failures
+  // back off exponentially: on the next tick, then after 1s, 2s, 4s ... up to 30s. A browser that stayed up
+  // for a minute starts over at the first attempt.
+  const double stableSeconds = 60.0;
+  const float maxDelay = 30.0f;
+  const double now = FPlatformTime::Seconds();
+  if (_LastRecoveryTime >= 0.0 && now - _LastRecoveryTime > stableSeconds)
+  {
+    _RecoveryAttempts = 0;
+  }
+  if (_MaxRecoveryAttempts > 0 && _RecoveryAttempts >= _MaxRecoveryAttempts)
+  {
+    UE_LOG(LogNEONWidget, Error, TEXT("Browser failed %d times in a row (%s). Not recovering."), _RecoveryAttempts, *Reason);
+    return;
+  }
+  const float delay = _RecoveryAttempts == 0 ? 0.0f : FMath::Min(FMath::Pow(2.0f, static_cast<float>(_RecoveryAttempts - 1)), maxDelay);
+  _RecoveryAttempts++;
+
+  UE_LOG(LogNEONWidget, Warning, TEXT("Recovering browser in %.0fs (attempt %d): %s"), delay, _RecoveryAttempts, *Reason);
+  _PendingReplay = _ReplayStateAfterRecovery && _LastInvocations.Num() > 0;
+
+  // Restarting from inside a CEF callback would close the browser that is currently calling us
+  TWeakObjectPtr<UNEONWidget> weakThis(this);
+  FTimerDelegate restart = FTimerDelegate::CreateLambda(
+      [weakThis, Reason]()
+      {
+        if (!weakThis.IsValid())
+          return;
+        weakThis->_LastRecoveryTime = FPlatformTime::Seconds();
+        weakThis->RestartBrowser();
+        weakThis->OnBrowserRecovered(Reason);
+      });
+  if (delay > 0.0f)
+  {
+    timerManager.SetTimer(_RecoveryTimerHandle, restart, delay, false);
+  }
+  else
+  {
+    _RecoveryTimerHandle = timerManager.SetTimerForNextTick(restart);
+  }
+}
+
+bool UNEONWidget::HandleRenderProcessUnresponsive(CefRefPtr<CefUnresponsiveProcessCallback> Callback)
+{
+  UE_LOG(LogNEONWidget, Warning, TEXT("Render process is unresponsive."));
+
+  // Without recovery, let CEF keep waiting
+  if (!_AutoRecover)
+  {
+    return false;
+  }
+
+  _UnresponsiveCallback = Callback;
+
+  TWeakObjectPtr<UNEONWidget> weakThis(this);
+  GetWorld()->GetTimerManager().SetTimer(
+      _UnresponsiveTimerHandle,
+      [weakThis]()
+      {
+        if (!weakThis.IsValid() || !weakThis->_UnresponsiveCallback)
+          return;
+        UE_LOG(LogNEONWidget, Warning, TEXT("Render process still unresponsive after %.1fs. Terminating."), weakThis->_UnresponsiveTimeout);
+        CefRefPtr<CefUnresponsiveProcessCallback> callback = weakThis->_UnresponsiveCallback;
+        weakThis->_UnresponsiveCallback = nullptr;
+        // Leads to OnRenderProcessTerminated, which recovers the browser
+        callback->Terminate();
+      },
+      FMath::Max(_UnresponsiveTimeout, 0.1f),
+      false);
+  return true;
+}
+
+void UNEONWidget::HandleRenderProcessResponsive()
+{
+  UE_LOG(LogNEONWidget, Log, TEXT("Render process is responsive again."));
+  GetWorld()->GetTimerManager().ClearTimer(_UnresponsiveTimerHandle);
+  _UnresponsiveCallback = nullptr;
+}
+
+void UNEONWidget::HandleRenderProcessTerminated(int32 Status)
+{
+  GetWorld()->GetTimerManager().ClearTimer(_UnresponsiveTimerHandle);
+  _UnresponsiveCallback = nullptr;
+
+  RecoverBrowser(FString::Printf(TEXT("Render process terminated with status %d"), Status));
+}
+
+void UNEONWidget::HandleMainFrameLoaded(int HttpStatusCode)
+{
+  if (_MeasureInputLatency)
+  {
+    // The page counts inputs from here on, so both sides start at zero
+    _LatencyProbe.Reset();
+    ExecuteScript(TEXT("window.NEON_Bridge_Latency_Enable && window.NEON_Bridge_Latency_Enable(true);"));
+  }
+
+  if (!_PendingReplay)
+  {
+    return;
+  }
+  _PendingReplay = false;
+
+  UE_LOG(LogNEONWidget, Log, TEXT("Replaying %d invocations after recovery."), _LastInvocations.Num());
+  for (const TPair<FString, FString> &invocation : _LastInvocations)
+  {
+    ExecuteScript(invocation.Value);
+  }
+}
+
+void UNEONWidget::HandleLatencyEcho(int32 Sequence)
+{
+  if (_MeasureInputLatency)
+  {
+    _LatencyProbe.OnEcho(Sequence);
+  }
+}
+
+void UNEONWidget::RecordQueryDispatchTime(double Milliseconds)
+{
+  _LastQueryDispatchMs = static_cast<float>(Milliseconds);
+  _MaxQueryDispatchMs = FMath::Max(_MaxQueryDispatchMs, _LastQueryDispatchMs);
+}
+
+void UNEONWidget::RecordQueryRoundTrips(int32 Count, double TotalMilliseconds, double MaxMilliseconds)
+{
+  if (Count <= 0)
+  {
+    return;
+  }
+
+  _QueryRoundTripMs = static_cast<float>(TotalMilliseconds / Count);
+  _MaxQueryRoundTripMs = FMath::Max(_MaxQueryRoundTripMs, static_cast<float>(MaxMilliseconds));
+
+  if (_SlowQueryWarningMs > 0.0f && MaxMilliseconds > _SlowQueryWarningMs)
+  {
+    UE_LOG(LogNEONWidget, Warning, TEXT("Slow bridge query: %.2fms round trip (%.2fms avg over %d, last dispatch %.2fms)"),
+           MaxMilliseconds, _QueryRoundTripMs, Count, _LastQueryDispatchMs);
+  }
+}
+
 void UNEONWidget::OnAcceleratedPaint_Widget(HANDLE SharedHandle)
 {
   if (!_View)
@@ -268,6 +552,9 @@ void UNEONWidget::OnAcceleratedPaint_Widget(HANDLE SharedHandle)
   // Increment transient FPS each time we receive a main texture update.
   _FPSTransient++;
 
+  if (_MeasureInputLatency)
+    _LatencyProbe.OnPaint();
+
   _View->OnAcceleratedPaint_View(SharedHandle);
 }
 
@@ -291,110 +578,243 @@ void UNEONWidget::InvalidateBrowser()
   _Browser->GetHost()->Invalidate(PET_VIEW);
 }
 
-void UNEONWidget::InvokeWebNoParam(const FString &Method)
+namespace
+{
+  // Logs the result of bridge calls that did not come from the page
+  class NEONLogBridgeResponder : public NEONBridgeResponder
+  {
+  public:
+    virtual void Success(const FString &Response) override
+    {
+      UE_LOG(LogNEONWidget, Verbose, TEXT("InvokeUnreal succeeded: %s"), *Response);
+    }
+    virtual void Failure(int32 ErrorCode, const FString &ErrorMessage) override
+    {
+      UE_LOG(LogNEONWidget, Warning, TEXT("InvokeUnreal failed (%d): %s"), ErrorCode, *ErrorMessage);
+    }
+  };
+}
+
+void UNEONWidget::ExecuteScript(const FString &Script)
 {
+  ExecuteScript(Script, CefString(TCHAR_TO_UTF8(*Script)));
+}
+
+void UNEONWidget::ExecuteScript(const FString &Script, const CefString &CefScript)
+{
+  OnScriptExecuted.Broadcast(Script);
+
+  if (_IsHeadless)
+  {
+    UE_LOG(LogNEONWidget, Verbose, TEXT("Headless script: %s"), *Script);
+    return;
+  }
+
   if (!_Browser)
   {
     UE_LOG(LogNEONWidget, Error, TEXT("Tried to invoke web when browser is null."));
     return;
   }
 
-  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\");"), *Method);
-
-  const CefString &CefScript = CefString(TCHAR_TO_UTF8(*Script));
   _Browser->GetMainFrame()->ExecuteJavaScript(CefScript, _Browser->GetMainFrame()->GetURL(), 0);
 }
 
-void UNEONWidget::InvokeWeb(const FString &Method, const FJsonObjectWrapper &JsonObjectWrapper)
+void UNEONWidget::ExecuteInvocation(const FString &Method, const FString &Script, FNEONBridgeRecorder::EInvocationKind Kind, const FString &Value)
 {
-  if (!_Browser)
+  INC_DWORD_STAT(STAT_NEON_InvokeWebCalls);
+  CSV_CUSTOM_STAT(NEON, InvokeWebCalls, 1, ECsvCustomStatOp::Accumulate);
+  FNEONBridgeRecorder::RecordInvocation(this, Method, Kind, Value);
+
+  if (_ReplayStateAfterRecovery)
   {
-    UE_LOG(LogNEONWidget, Error, TEXT("Tried to invoke web when browser is null."));
-    return;
+    _LastInvocations.Add(Method, Script);
   }
+  ExecuteScript(Script);
+}
 
+void UNEONWidget::SubscribeTopic(FName Topic)
+{
+  FModuleManager::GetModuleChecked<FNEONModule>("NEON").GetBroadcast().Subscribe(this, Topic);
+}
+
+void UNEONWidget::UnsubscribeTopic(FName Topic)
+{
+  FModuleManager::GetModuleChecked<FNEONModule>("NEON").GetBroadcast().Unsubscribe(this, Topic);
+  _TopicQueue.RemoveAll([Topic](const FNEONTopicMessageRef &Message)
+                        { return Message->Topic == Topic; });
+  _LatestTopicMessages.Remove(Topic);
+}
+
+int32 UNEONWidget::PublishTopic(FName Topic, const FJsonObjectWrapper &JsonObjectWrapper)
+{
   if (!JsonObjectWrapper.JsonObject.IsValid())
   {
     UE_LOG(LogNEONWidget, Error, TEXT("Invalid JSON object."));
-    return;
+    return 0;
   }
+  return FModuleManager::GetModuleChecked<FNEONModule>("NEON").GetBroadcast().Publish(Topic, JsonObjectWrapper.JsonObject.ToSharedRef());
+}
 
-  // Serialize the JSON object
-  FString JSONData;
-  TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSONData);
-  FJsonSerializer::Serialize(JsonObjectWrapper.JsonObject.ToSharedRef(), Writer);
+int32 UNEONWidget::PublishTopicNoParam(FName Topic)
+{
+  return FModuleManager::GetModuleChecked<FNEONModule>("NEON").GetBroadcast().Publish(Topic);
+}
 
-  // Properly escape JSON data for JavaScript
-  FString EscapedJson = JSONData.Replace(TEXT("\\"), TEXT("\\\\"))
-                            .Replace(TEXT("\""), TEXT("\\\""))
-                            .Replace(TEXT("\n"), TEXT("\\n"))
-                            .Replace(TEXT("\r"), TEXT("\\r"))
-                            .Replace(TEXT("\t"), TEXT("\\t"));
+bool UNEONWidget::IsHiddenForTopics() const
+{
+  if (_IsHeadless)
+    return false;
+  return !_Browser || _IsFrozen || !IsVisible() || GFrameCounter - _LastShownFrame > NEONTopicShownFrames;
+}
 
-  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", \"%s\");"), *Method, *EscapedJson);
+void UNEONWidget::EnqueueTopicMessage(const FNEONTopicMessageRef &Message)
+{
+  if (!IsHiddenForTopics() && _TopicQueue.Num() < NEONMaxQueuedTopicMessages)
+  {
+    _TopicQueue.Add(Message);
+    return;
+  }
 
-  const CefString &CefScript = CefString(TCHAR_TO_UTF8(*Script));
-  _Browser->GetMainFrame()->ExecuteJavaScript(CefScript, _Browser->GetMainFrame()->GetURL(), 0);
+  // Hidden or backed up: the page only needs the latest state of each topic once it is visible again
+  for (const FNEONTopicMessageRef &queued : _TopicQueue)
+  {
+    _LatestTopicMessages.Add(queued->Topic, queued);
+  }
+  _TopicQueue.Reset();
+
+  const int32 count = _LatestTopicMessages.Num();
+  _LatestTopicMessages.Add(Message->Topic, Message);
+  if (_LatestTopicMessages.Num() == count)
+  {
+    INC_DWORD_STAT(STAT_NEON_TopicCoalesced);
+  }
 }
 
-void UNEONWidget::InvokeWebBoolean(const FString &Method, bool Value)
+void UNEONWidget::FlushTopicMessages()
 {
-  if (!_Browser)
+  if ((_TopicQueue.IsEmpty() && _LatestTopicMessages.IsEmpty()) || IsHiddenForTopics())
   {
-    UE_LOG(LogNEONWidget, Error, TEXT("Tried to invoke web when browser is null."));
     return;
   }
 
-  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", %s);"), *Method, Value ? TEXT("true") : TEXT("false"));
+  // Coalesced messages are older than anything queued after the widget became visible
+  TArray<FNEONTopicMessageRef> messages;
+  messages.Reserve(_LatestTopicMessages.Num() + _TopicQueue.Num());
+  for (const TPair<FName, FNEONTopicMessageRef> &latest : _LatestTopicMessages)
+  {
+    messages.Add(latest.Value);
+  }
+  messages.Append(MoveTemp(_TopicQueue));
+  _LatestTopicMessages.Reset();
+  _TopicQueue.Reset();
 
-  const CefString &CefScript = CefString(TCHAR_TO_UTF8(*Script));
-  _Browser->GetMainFrame()->ExecuteJavaScript(CefScript, _Browser->GetMainFrame()->GetURL(), 0);
+  for (const FNEONTopicMessageRef &message : messages)
+  {
+    const FString method = message->Topic.ToString();
+    INC_DWORD_STAT(STAT_NEON_TopicDeliveries);
+    CSV_CUSTOM_STAT(NEON, TopicDeliveries, 1, ECsvCustomStatOp::Accumulate);
+    FNEONBridgeRecorder::RecordInvocation(this, method,
+                                          message->Json.IsEmpty() ? FNEONBridgeRecorder::EInvocationKind::NoParam : FNEONBridgeRecorder::EInvocationKind::Json,
+                                          message->Json);
+
+    if (_ReplayStateAfterRecovery)
+    {
+      _LastInvocations.Add(method, message->Script);
+    }
+    ExecuteScript(message->Script, message->CefScript);
+  }
 }
-void UNEONWidget::InvokeWebInteger(const FString &Method, int32 Value)
+
+void UNEONWidget::InvokeUnreal(const FString &Data)
 {
-  if (!_Browser)
+  if (!_MessageHandler)
   {
-    UE_LOG(LogNEONWidget, Error, TEXT("Tried to invoke web when browser is null."));
+    UE_LOG(LogNEONWidget, Error, TEXT("Tried to invoke unreal without a message handler."));
     return;
   }
 
-  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", %d);"), *Method, Value);
+  NEONLogBridgeResponder responder;
+  _MessageHandler->HandleQuery(Data, responder);
+}
 
-  const CefString &CefScript = CefString(TCHAR_TO_UTF8(*Script));
-  _Browser->GetMainFrame()->ExecuteJavaScript(CefScript, _Browser->GetMainFrame()->GetURL(), 0);
+void UNEONWidget::InvokeWebNoParam(const FString &Method)
+{
+  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\");"), *Method);
+  ExecuteInvocation(Method, Script, FNEONBridgeRecorder::EInvocationKind::NoParam, FString());
 }
-void UNEONWidget::InvokeWebFloat(const FString &Method, float Value)
+
+void UNEONWidget::InvokeWeb(const FString &Method, const FJsonObjectWrapper &JsonObjectWrapper)
 {
-  if (!_Browser)
+  if (!JsonObjectWrapper.JsonObject.IsValid())
   {
-    UE_LOG(LogNEONWidget, Error, TEXT("Tried to invoke web when browser is null."));
+    UE_LOG(LogNEONWidget, Error, TEXT("Invalid JSON object."));
     return;
   }
 
-  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", %f);"), *Method, Value);
+  // Serialize the JSON object
+  FString JSONData;
+  TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSONData);
+  FJsonSerializer::Serialize(JsonObjectWrapper.JsonObject.ToSharedRef(), Writer);
 
-  const CefString &CefScript = CefString(TCHAR_TO_UTF8(*Script));
-  _Browser->GetMainFrame()->ExecuteJavaScript(CefScript, _Browser->GetMainFrame()->GetURL(), 0);
+  FString EscapedJson = EscapeScriptString(JSONData);
+
+  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", \"%s\");"), *Method, *EscapedJson);
+  ExecuteInvocation(Method, Script, FNEONBridgeRecorder::EInvocationKind::Json, JSONData);
 }
-void UNEONWidget::InvokeWebString(const FString &Method, const FString &Value)
+
+void UNEONWidget::InvokeWebBoolean(const FString &Method, bool Value)
 {
-  if (!_Browser)
+  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", %s);"), *Method, Value ? TEXT("true") : TEXT("false"));
+  ExecuteInvocation(Method, Script, FNEONBridgeRecorder::EInvocationKind::Boolean, Value ? TEXT("true") : TEXT("false"));
+}
+void UNEONWidget::InvokeWebInteger(const FString &Method, int32 Value)
+{
+  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", %d);"), *Method, Value);
+  ExecuteInvocation(Method, Script, FNEONBridgeRecorder::EInvocationKind::Integer, FString::FromInt(Value));
+}
+void UNEONWidget::InvokeWebFloat(const FString &Method, float Value)
+{
+  FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", %f);"), *Method, Value);
+  ExecuteInvocation(Method, Script, FNEONBridgeRecorder::EInvocationKind::Float, FString::SanitizeFloat(Value));
+}
+FString UNEONWidget::EscapeScriptString(const FString &Value)
+{
+  // One pass instead of a Replace per character, payloads can be large
+  FString escaped;
+  escaped.Reserve(Value.Len() + Value.Len() / 8);
+  for (TCHAR character : Value)
   {
-    UE_LOG(LogNEONWidget, Error, TEXT("Tried to invoke web when browser is null."));
-    return;
+    switch (character)
+    {
+    case TEXT('\\'):
+      escaped += TEXT("\\\\");
+      break;
+    case TEXT('"'):
+      escaped += TEXT("\\\"");
+      break;
+    case TEXT('\n'):
+      escaped += TEXT("\\n");
+      break;
+    case TEXT('\r'):
+      escaped += TEXT("\\r");
+      break;
+    case TEXT('\t'):
+      escaped += TEXT("\\t");
+      break;
+    default:
+      escaped.AppendChar(character);
+      break;
+    }
   }
+  return escaped;
+}
 
-  // Properly escape the string for JavaScript
-  FString EscapedValue = Value.Replace(TEXT("\\"), TEXT("\\\\"))
-                             .Replace(TEXT("\""), TEXT("\\\""))
-                             .Replace(TEXT("\n"), TEXT("\\n"))
-                             .Replace(TEXT("\r"), TEXT("\\r"))
-                             .Replace(TEXT("\t"), TEXT("\\t"));
+void UNEONWidget::InvokeWebString(const FString &Method, const FString &Value)
+{
+  FString EscapedValue = EscapeScriptString(Value);
 
   FString Script = FString::Printf(TEXT("NEON_Bridge_Web_Invoke(\"%s\", \"%s\");"), *Method, *EscapedValue);
-
-  const CefString &CefScript = CefString(TCHAR_TO_UTF8(*Script));
-  _Browser->GetMainFrame()->ExecuteJavaScript(CefScript, _Browser->GetMainFrame()->GetURL(), 0);
+  ExecuteInvocation(Method, Script, FNEONBridgeRecorder::EInvocationKind::String, Value);
 }
 
 FReply UNEONWidget::NativeOnMouseButtonDown(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent)
@@ -416,17 +836,35 @@ FReply UNEONWidget::NativeOnMouseButtonUp(const FGeometry &MyGeometry, const FPo
 FReply UNEONWidget::NativeOnMouseButtonDoubleClick(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent)
 {
   UE_LOG(LogNEONWidget, Warning, TEXT("[CLICK DEBUG] NativeOnMouseButtonDoubleClick - Button: %s"), *MouseEvent.GetEffectingButton().ToString());
-  HandleMouseButtonEvent(MyGeometry, MouseEvent, false);
+  HandleMouseButtonEvent(MyGeometry, MouseEvent, false, true);
   UE_LOG(LogNEONWidget, Warning, TEXT("[CLICK DEBUG] NativeOnMouseButtonDoubleClick Reply - IsHandled: TRUE (forced)"));
   return FReply::Handled();
 }
 
 FReply UNEONWidget::NativeOnMouseMove(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent)
 {
+  if (_DrawSoftwareCursor)
+  {
+    _CursorPosition = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+    _IsCursorInside = true;
+    Invalidate(EInvalidateWidgetReason::Paint);
+  }
+
   HandleMouseMoveEvent(MyGeometry, MouseEvent);
   return FReply::Handled();
 }
 
+void UNEONWidget::NativeOnMouseLeave(const FPointerEvent &MouseEvent)
+{
+  Super::NativeOnMouseLeave(MouseEvent);
+
+  if (_IsCursorInside)
+  {
+    _IsCursorInside = false;
+    Invalidate(EInvalidateWidgetReason::Paint);
+  }
+}
+
 FReply UNEONWidget::NativeOnMouseWheel(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent)
 {
   HandleMouseWheelEvent(MyGeometry, MouseEvent);
@@ -451,7 +889,7 @@ FReply UNEONWidget::NativeOnKeyChar(const FGeometry &MyGeometry, const FCharacte
   return FReply::Handled();
 }
 
-void UNEONWidget::HandleMouseButtonEvent(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent, bool bIsMouseUp)
+void UNEONWidget::HandleMouseButtonEvent(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent, bool bIsMouseUp, bool bIsDoubleClick)
 {
   if (!_Browser)
   {
@@ -490,6 +928,12 @@ void UNEONWidget::HandleMouseButtonEvent(const FGeometry &MyGeometry, const FPoi
          cefEvent.x,
          cefEvent.y);
 
+  // Only what the page's pointerdown counter sees: the first button going down. Further buttons while one is held
+  // (chords) and the second press of a double click are not counted there, counting them here would pair every
+  // following echo with the wrong input.
+  if (_MeasureInputLatency && !bIsMouseUp && !bIsDoubleClick && MouseEvent.GetPressedButtons().Num() <= 1)
+    _LatencyProbe.OnInput();
+
   _Browser->GetHost()->SendMouseClickEvent(cefEvent, buttonType, bIsMouseUp, 1);
 }
 
@@ -518,6 +962,10 @@ void UNEONWidget::HandleKeyEvent(const FKeyEvent &InKeyEvent, bool bIsKeyUp)
   if (!_Browser)
     return;
   CefKeyEvent cefEvent = GetCefKeyEvent(InKeyEvent, bIsKeyUp);
+
+  if (_MeasureInputLatency && !bIsKeyUp)
+    _LatencyProbe.OnInput();
+
   _Browser->GetHost()->SendKeyEvent(cefEvent);
 }
 
@@ -603,7 +1051,7 @@ void UNEONWidget::SetPopupVisible(bool Visible)
     return;
   }
   _View->SetPopupVisible(Visible);
-  UE_LOG(LogNEONWidget, Log, TEXT("Popup visibility: %d"), Visible);
+  UE_LOG(LogNEONWidget, Verbose, TEXT("Popup visibility: %d"), Visible);
 }
 
 void UNEONWidget::SetPopupRect(int InX, int InY, int InWidth, int InHeight)
@@ -616,3 +1064,116 @@ void UNEONWidget::SetPopupRect(int InX, int InY, int InWidth, int InHeight)
   _View->SetPopupPosition(FVector2D(InX, InY));
   _View->SetPopupSize(FVector2D(InWidth, InHeight));
 }
+
+//----------------------------------------------------------------------
+// Cursor
+//----------------------------------------------------------------------
+void UNEONWidget::HandleCursorChange(EMouseCursor::Type Cursor)
+{
+  if (_BrowserCursor == Cursor)
+    return;
+  _BrowserCursor = Cursor;
+
+  const bool softwareCursor = _DrawSoftwareCursor && _CursorStyles.Contains(Cursor);
+  SetCursor(softwareCursor ? EMouseCursor::None : Cursor);
+
+  if (_DrawSoftwareCursor)
+    Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+int32 UNEONWidget::NativePaint(const FPaintArgs &Args, const FGeometry &AllottedGeometry, const FSlateRect &MyCullingRect,
+                               FSlateWindowElementList &OutDrawElements, int32 LayerId, const FWidgetStyle &InWidgetStyle,
+                               bool bParentEnabled) const
+{
+  int32 maxLayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+  _LastShownFrame = GFrameCounter;
+
+  // The popup rect is in texture pixels, the widget is laid out in slate units
+  if (_View && _View->IsPopupVisible() && _View->HasPopupFrame() && _ScaleFactor > 0.0f)
+  {
+    const float toLocal = 1.0f / (_ScaleFactor * _RenderScale);
+    FSlateDrawElement::MakeBox(
+        OutDrawElements,
+        ++maxLayerId,
+        AllottedGeometry.ToPaintGeometry(_View->GetPopupSize() * toLocal, FSlateLayoutTransform(_View->GetPopupPosition() * toLocal)),
+        &_PopupBrush,
+        ESlateDrawEffect::None,
+        InWidgetStyle.GetColorAndOpacityTint());
+  }
+
+  if (!_DrawSoftwareCursor || !_IsCursorInside)
+    return maxLayerId;
+
+  const FNEONCursorStyle *style = _CursorStyles.Find(_BrowserCursor);
+  if (!style)
+    return maxLayerId;
+
+  FSlateDrawElement::MakeBox(
+      OutDrawElements,
+      ++maxLayerId,
+      AllottedGeometry.ToPaintGeometry(style->Brush.GetImageSize(), FSlateLayoutTransform(_CursorPosition - style->Hotspot)),
+      &style->Brush,
+      ESlateDrawEffect::None,
+      style->Brush.GetTint(InWidgetStyle) * InWidgetStyle.GetColorAndOpacityTint());
+  return maxLayerId;
+}
+
+//----------------------------------------------------------------------
+// Audio
+//----------------------------------------------------------------------
+void UNEONWidget::SetAudioVolume(float Volume)
+{
+  _AudioVolume = FMath::Max(Volume, 0.0f);
+  if (_AudioComponent)
+    _AudioComponent->SetVolumeMultiplier(_AudioVolume);
+}
+
+void UNEONWidget::UpdateAudio()
+{
+  if (!_Client)
+    return;
+
+  TSharedPtr<FNEONAudioStream, ESPMode::ThreadSafe> stream = _Client->GetAudioStream();
+  const uint32 generation = stream->GetGeneration();
+  if (generation == _AudioGeneration)
+    return;
+  _AudioGeneration = generation;
+
+  if (!stream->IsPlaying())
+  {
+    if (_AudioComponent)
+      _AudioComponent->Stop();
+    return;
+  }
+
+  // The synth's format is fixed once it has been started
+  if (_AudioComponent && !_AudioComponent->MatchesFormat(*stream))
+    DestroyAudio();
+
+  if (!_AudioComponent)
+  {
+    UWorld *world = GetWorld();
+    if (!world)
+      return;
+
+    _AudioComponent = NewObject<UNEONAudioComponent>(this);
+    _AudioComponent->SetStream(stream);
+    _AudioComponent->SoundClass = _AudioSoundClass;
+    _AudioComponent->SoundSubmix = _AudioSubmix;
+    _AudioComponent->RegisterComponentWithWorld(world);
+    UE_LOG(LogNEONWidget, Log, TEXT("Routing browser audio into the mixer (%d Hz, %d channels)."), stream->GetSampleRate(), stream->GetNumChannels());
+  }
+
+  _AudioComponent->SetVolumeMultiplier(_AudioVolume);
+  _AudioComponent->Start();
+}
+
+void UNEONWidget::DestroyAudio()
+{
+  if (!_AudioComponent)
+    return;
+
+  _AudioComponent->Stop();
+  _AudioComponent->DestroyComponent();
+  _AudioComponent = nullptr;
+}
@@ -9,6 +9,11 @@
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 
+#include "NEONBroadcast.h"
+#include "NEONProfile.h"
+#include "NEONProfileBenchmark.h"
+#include "NEONResourceMonitor.h"
+
 class FNEONModule : public IModuleInterface
 {
 public:
@@ -19,12 +24,37 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NEON")
 	void SetProcessingTime(float ProcessingTime);
 
+	/**
+	 * Headless mode: dedicated servers, commandlets, -nullrhi runs or -NEONHeadless.
+	 * libcef.dll is never loaded and no CEF subprocesses are spawned. UNEONWidget falls back to a stub view
+	 * that still dispatches bridge calls.
+	 */
+	bool IsHeadless() const { return _IsHeadless; }
+
+	bool IsInitialized() const { return _IsInitialized; }
+
+	/** The profile CEF was (or will be) initialized with. */
+	const FNEONProfile &GetProfile() const { return _Profile; }
+
+	FNEONResourceMonitor &GetResourceMonitor() { return _ResourceMonitor; }
+
+	/** Topic based Unreal -> web messages for many widgets at once. */
+	FNEONBroadcast &GetBroadcast() { return _Broadcast; }
+
 private:
-	void *_LibecfHandle;
+	void *_LibecfHandle = nullptr;
 
+	bool _IsHeadless = false;
 	bool _IsInitialized = false;
 	float _ProcessingTime = 0.0f;
 
+	FNEONProfile _Profile;
+	FNEONProfileBenchmark _ProfileBenchmark;
+	FNEONResourceMonitor _ResourceMonitor;
+	FNEONBroadcast _Broadcast;
+
+	static bool DetectHeadless();
+
 	void OnPreWorldInitialization(UWorld *World, const UWorld::InitializationValues IVS);
 	void OnWorldTickStart(UWorld *World, ELevelTick TickType, float DeltaSeconds);
 	void OnWorldTickEnd(UWorld *World, ELevelTick TickType, float DeltaSeconds);
@@ -12,10 +12,13 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #include "Windows/HideWindowsPlatformTypes.h"
 
+#include "NEONProfile.h"
+
 class NEONApp : public CefApp
 {
 public:
-  NEONApp()
+  NEONApp(const FNEONProfile &Profile)
+      : _Profile(Profile)
   {
   }
 
@@ -24,8 +27,6 @@ public:
   {
     CommandLine->AppendSwitch("enable-gpu");
     CommandLine->AppendSwitch("enable-gpu-compositing");
-    CommandLine->AppendSwitch("enable-gpu-rasterization");
-    // CommandLine->AppendSwitch("enable-zero-copy");
     CommandLine->AppendSwitch("enable-gpu-vsync");
     CommandLine->AppendSwitch("enable-accelerated-video");
     CommandLine->AppendSwitch("enable-accelerated-video-decode");
@@ -36,7 +37,6 @@ public:
     // CommandLine->AppendSwitch("enable-gpu-service-tracing");
     // CommandLine->AppendSwitch("enable-gpu-logging");
     // CommandLine->AppendSwitch("enable-draw-fps");
-    // CommandLine->AppendSwitch("disable-gpu-shader-disk-cache");
     // CommandLine->AppendSwitch("show-fps-counter");
 
     CommandLine->AppendSwitch("disable-extensions");
@@ -47,6 +47,8 @@ public:
 
     // CommandLine->AppendSwitch("gpu-startup-dialog");
 
+    ApplyProfile(CommandLine);
+
 #if WITH_EDITOR
     CommandLine->AppendSwitchWithValue("log-severity", "verbose");
     CommandLine->AppendSwitchWithValue("v", "3");
@@ -59,5 +61,44 @@ public:
 #endif
   }
 
+private:
+  // Process model and GPU switches from the active NEON profile (see NEONProfile.h)
+  void ApplyProfile(CefRefPtr<CefCommandLine> CommandLine)
+  {
+    CommandLine->AppendSwitch(_Profile.bGpuRasterization ? "enable-gpu-rasterization" : "disable-gpu-rasterization");
+    if (_Profile.bZeroCopy)
+      CommandLine->AppendSwitch("enable-zero-copy");
+    if (!_Profile.bGpuShaderDiskCache)
+      CommandLine->AppendSwitch("disable-gpu-shader-disk-cache");
+
+    if (_Profile.RendererProcessLimit > 0)
+      CommandLine->AppendSwitchWithValue("renderer-process-limit", TCHAR_TO_UTF8(*FString::FromInt(_Profile.RendererProcessLimit)));
+
+    if (!_Profile.bSiteIsolation)
+    {
+      CommandLine->AppendSwitch("disable-site-isolation-trials");
+      CommandLine->AppendSwitchWithValue("disable-features", "IsolateOrigins,site-per-process");
+    }
+
+    FString jsFlags = _Profile.JsFlags;
+    if (_Profile.JsHeapLimitMB > 0)
+      jsFlags = FString::Printf(TEXT("--max-old-space-size=%d %s"), _Profile.JsHeapLimitMB, *jsFlags).TrimEnd();
+    if (!jsFlags.IsEmpty())
+      CommandLine->AppendSwitchWithValue("js-flags", TCHAR_TO_UTF8(*jsFlags));
+
+    if (!_Profile.bBackgroundTimerThrottling)
+    {
+      CommandLine->AppendSwitch("disable-background-timer-throttling");
+      CommandLine->AppendSwitch("disable-renderer-backgrounding");
+      CommandLine->AppendSwitch("disable-backgrounding-occluded-windows");
+    }
+
+    // Audio reaches the game through CefAudioHandler, Chromium must not play it a second time
+    if (_Profile.bRouteAudio)
+      CommandLine->AppendSwitch("mute-audio");
+  }
+
+  FNEONProfile _Profile;
+
   IMPLEMENT_REFCOUNTING(NEONApp);
 };
\ No newline at end of file
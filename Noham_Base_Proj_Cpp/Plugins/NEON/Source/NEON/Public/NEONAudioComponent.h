@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONAudioComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SynthComponent.h"
+
+#include "NEONAudioStream.h"
+
+#include "NEONAudioComponent.generated.h"
+
+/**
+ * Plays the audio of a NEON browser through the UE audio mixer, so it follows sound class, submix and device
+ * settings like any other UI sound. Created and started by UNEONWidget when the page starts streaming audio.
+ */
+UCLASS(ClassGroup = NEON, NotBlueprintable)
+class NEON_API UNEONAudioComponent : public USynthComponent
+{
+  GENERATED_BODY()
+
+public:
+  UNEONAudioComponent(const FObjectInitializer &ObjectInitializer);
+
+  /** Must be called before the first Start. Format changes need a new component. */
+  void SetStream(TSharedPtr<FNEONAudioStream, ESPMode::ThreadSafe> Stream);
+
+  bool MatchesFormat(const FNEONAudioStream &Stream) const
+  {
+    return _SampleRate == Stream.GetSampleRate() && _NumChannels == Stream.GetNumChannels();
+  }
+
+protected:
+  virtual bool Init(int32 &SampleRate) override;
+  virtual int32 OnGenerateAudio(float *OutAudio, int32 NumSamples) override;
+
+private:
+  // Shared with the NEONClient, kept alive here until the audio render thread is done with it
+  TSharedPtr<FNEONAudioStream, ESPMode::ThreadSafe> _Stream;
+
+  int32 _SampleRate = 48000;
+  int32 _NumChannels = 2;
+};
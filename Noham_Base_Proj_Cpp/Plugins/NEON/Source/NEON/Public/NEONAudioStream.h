@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONAudioStream.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DSP/Dsp.h"
+
+#include <atomic>
+
+/**
+ * Audio of one browser, handed from CEF's audio capture thread to the UE audio render thread.
+ *
+ * NEONClient pushes the planar packets of CefAudioHandler, UNEONAudioComponent pops interleaved samples in
+ * OnGenerateAudio. The buffer is a single producer / single consumer lock-free ring of fixed size, so neither side
+ * ever blocks or allocates. Streams are downmixed to at most two channels.
+ *
+ * Start and Stop bump the generation so the game thread can pick up format changes without a callback.
+ */
+class NEON_API FNEONAudioStream
+{
+public:
+  static constexpr int32 MaxChannels = 2;
+
+  FNEONAudioStream();
+
+  // CEF audio capture thread
+  void Start(int32 SampleRate, int32 NumChannels);
+  void Push(const float **Data, int32 Frames);
+  void Stop();
+
+  // Audio render thread. Returns the number of samples written, the rest of OutAudio is left untouched.
+  int32 Pop(float *OutAudio, int32 NumSamples);
+
+  bool IsPlaying() const { return _IsPlaying.load(std::memory_order_acquire); }
+  int32 GetSampleRate() const { return _SampleRate.load(std::memory_order_acquire); }
+  int32 GetNumChannels() const { return _NumChannels.load(std::memory_order_acquire); }
+  uint32 GetGeneration() const { return _Generation.load(std::memory_order_acquire); }
+
+  /** Samples dropped because the consumer fell behind. */
+  int64 GetDroppedSamples() const { return _DroppedSamples.load(std::memory_order_relaxed); }
+
+private:
+  Audio::TCircularAudioBuffer<float> _Buffer;
+
+  // Producer only
+  TArray<float> _Interleaved;
+  int32 _SourceChannels = 0;
+
+  std::atomic<int32> _SampleRate{48000};
+  std::atomic<int32> _NumChannels{2};
+  std::atomic<bool> _IsPlaying{false};
+  std::atomic<uint32> _Generation{0};
+  std::atomic<int64> _DroppedSamples{0};
+};
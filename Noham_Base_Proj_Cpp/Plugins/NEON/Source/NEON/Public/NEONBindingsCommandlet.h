@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBindingsCommandlet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "NEONBindingsCommandlet.generated.h"
+
+/**
+ * Generates typed neon-ue-web bindings for every UNEONWidget class, native and Blueprint.
+ *
+ *   UnrealEditor-Cmd <Project> -run=NEONBindings [-Output=<dir>]
+ *
+ * Writes neon-bindings.js and neon-bindings.d.ts to <Project>/NEON/bindings unless -Output is given. There is one
+ * export per widget class with a method per Invoke_ / OnInvoke_ delegate. Parameters and results are typed from the
+ * UFUNCTION signature, and calls are sent by binding ID (see NEONBridgeBindings.h) instead of by name.
+ *
+ * Returns 1 if two delegates of a class share an ID.
+ */
+UCLASS()
+class NEON_API UNEONBindingsCommandlet : public UCommandlet
+{
+  GENERATED_BODY()
+
+public:
+  UNEONBindingsCommandlet();
+
+  virtual int32 Main(const FString &Params) override;
+};
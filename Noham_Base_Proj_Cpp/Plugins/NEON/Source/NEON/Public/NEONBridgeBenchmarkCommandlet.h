@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeBenchmarkCommandlet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "NEONBridgeBenchmarkCommandlet.generated.h"
+
+/**
+ * Benchmarks NEONMessageHandler without a browser. Synthetic requests, from scalars up to large arrays and nested
+ * JsonObjectWrappers, are dispatched to UNEONBridgeBenchmarkWidget through HandleQuery. The module runs headless in
+ * commandlets, so libcef is never loaded.
+ *
+ *   UnrealEditor-Cmd <Project> -run=NEONBridgeBenchmark -nullrhi [-Iterations=20000] [-Baseline=<csv>] [-Threshold=0.15] [-Output=<csv>]
+ *
+ * Results (queries per second, allocations per query, p50/p99 latency) are written to
+ * Saved/Profiling/NEON/BridgeBenchmark.csv unless -Output is given. With -Baseline, the commandlet returns a non-zero
+ * exit code if a payload's throughput or p99 latency regressed by more than -Threshold (fraction, default 0.15).
+ *
+ * Win64 only, like the rest of the module: NEON.uplugin whitelists Win64 and UNEONWidget (which the handler and
+ * UNEONBridgeBenchmarkWidget need) includes the CEF and D3D headers. -nullrhi keeps it off the GPU, but CI has to run
+ * it on a Windows agent with the Win64 editor build, e.g.
+ *
+ *   Engine\Build\BatchFiles\Build.bat <Project>Editor Win64 Development -project=<uproject>
+ *   UnrealEditor-Cmd.exe <uproject> -run=NEONBridgeBenchmark -nullrhi -unattended -Baseline=<csv>
+ *
+ * A Linux agent would need the handler split into a module without CEF first.
+ */
+UCLASS()
+class NEON_API UNEONBridgeBenchmarkCommandlet : public UCommandlet
+{
+  GENERATED_BODY()
+
+public:
+  UNEONBridgeBenchmarkCommandlet();
+
+  virtual int32 Main(const FString &Params) override;
+};
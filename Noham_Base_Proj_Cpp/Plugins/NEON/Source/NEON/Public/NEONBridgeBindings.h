@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeBindings.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Stable integer IDs for the bridge delegates of a widget (UFUNCTIONs named Invoke_* and OnInvoke_*).
+ *
+ * The ID is the CRC (FCrc::StrCrc32) of the delegate name, so it is stable across builds. The page can send
+ * { type, id, parameters } instead of { type, delegate, parameters }. NEONMessageHandler then resolves the UFunction
+ * through a per-widget table built once from reflection, instead of a name lookup per query, and rejects an ID whose
+ * delegate does not match the requested type.
+ *
+ * Pages must take the IDs from the encoders UNEONBindingsCommandlet generates for neon-ue-web, not hash names
+ * themselves; regenerate them when delegates are added or renamed.
+ */
+struct NEON_API FNEONBridgeBindings
+{
+  static const TCHAR *FunctionPrefix;
+  static const TCHAR *EventPrefix;
+
+  static uint32 GetDelegateId(const FString &DelegateName);
+
+  static bool IsFunction(const UFunction *Function);
+  static bool IsEvent(const UFunction *Function);
+
+  /** All bridge delegates of a widget class, including inherited ones, sorted by name. */
+  static void GetDelegates(const UClass *WidgetClass, TArray<UFunction *> &OutDelegates);
+
+  /** ID to delegate. Returns false and logs the names if two delegates share an ID. */
+  static bool BuildDispatchTable(const UClass *WidgetClass, TMap<uint32, UFunction *> &OutTable);
+};
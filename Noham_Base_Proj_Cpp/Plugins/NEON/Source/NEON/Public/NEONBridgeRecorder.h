@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeRecorder.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UNEONWidget;
+
+/**
+ * Records bridge traffic of all widgets to a compact binary log, to be replayed by UNEONBridgeReplayCommandlet.
+ *
+ * Captured are incoming queries (NEONMessageHandler::HandleQuery) and outgoing invocations (UNEONWidget::InvokeWeb*
+ * and topic deliveries). Invocations are stored as method, parameter kind and raw parameter, not as the encoded
+ * script, so a replay goes through the same marshalling.
+ * Widgets are written once, the first time they send or receive anything, and referenced by index afterwards.
+ * Timestamps are stored as packed microsecond deltas.
+ *
+ * Logs are written to Saved/Profiling/NEON/<time>.neonbridge unless a path is given.
+ *
+ * Console: neon.bridge.record.start [path], neon.bridge.record.stop
+ */
+class NEON_API FNEONBridgeRecorder
+{
+public:
+  enum class ERecordType : uint8
+  {
+    Widget = 0,
+    Query = 1,
+    Invocation = 2
+  };
+
+  // Which InvokeWeb* an invocation came through
+  enum class EInvocationKind : uint8
+  {
+    NoParam = 0,
+    Json = 1,
+    Boolean = 2,
+    Integer = 3,
+    Float = 4,
+    String = 5
+  };
+
+  struct FRecord
+  {
+    ERecordType Type = ERecordType::Query;
+    // Seconds since the recording started
+    double Time = 0.0;
+    int32 WidgetIndex = INDEX_NONE;
+    // Invocations only
+    FString Method;
+    EInvocationKind Kind = EInvocationKind::NoParam;
+    // The request JSON for queries, the unencoded parameter for invocations (JSON text, true/false, number or string)
+    FString Payload;
+  };
+
+  struct FWidget
+  {
+    FString ClassPath;
+    FString Name;
+  };
+
+  struct FLog
+  {
+    TArray<FWidget> Widgets;
+    TArray<FRecord> Records;
+  };
+
+  static bool Start(const FString &FilePath = FString());
+  static bool Stop();
+
+  static bool IsRecording() { return _Writer.IsValid(); }
+
+  static void RecordQuery(const UNEONWidget *Widget, const FString &Request);
+  static void RecordInvocation(const UNEONWidget *Widget, const FString &Method, EInvocationKind Kind, const FString &Value);
+
+  static bool Load(const FString &FilePath, FLog &OutLog);
+
+private:
+  static uint32 GetWidgetIndex(const UNEONWidget *Widget);
+  static void WriteHeader(ERecordType Type, uint32 WidgetIndex);
+
+  static TUniquePtr<FArchive> _Writer;
+  static FString _FilePath;
+  static TMap<FObjectKey, uint32> _WidgetIndices;
+  static uint64 _StartCycles;
+  static uint64 _LastMicroseconds;
+  static int64 _RecordCount;
+};
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBridgeReplayCommandlet.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "NEONBridgeReplayCommandlet.generated.h"
+
+/**
+ * Replays a log written by FNEONBridgeRecorder (neon.bridge.record.start) into headless widgets.
+ *
+ *   UnrealEditor-Cmd <Project> -run=NEONBridgeReplay -nullrhi -Log=<file.neonbridge> [-MaxSpeed] [-Loops=1] [-Output=<csv>]
+ *
+ * One widget of each recorded class is created and every recorded query is dispatched through
+ * NEONMessageHandler::HandleQuery. Recorded invocations are called again through the matching UNEONWidget::InvokeWeb*
+ * with their original parameters, so script building and escaping are part of the measurement. By default the
+ * original timing is kept; -MaxSpeed dispatches back to back to measure marshalling throughput.
+ *
+ * Widgets are created without a world or widget tree, so delegates that depend on either may fail; those count as
+ * failed queries in the results. A summary (queries/s, p50/p99 query and invocation time, failures) is appended to
+ * Saved/Profiling/NEON/BridgeReplay.csv unless -Output is given.
+ */
+UCLASS()
+class NEON_API UNEONBridgeReplayCommandlet : public UCommandlet
+{
+  GENERATED_BODY()
+
+public:
+  UNEONBridgeReplayCommandlet();
+
+  virtual int32 Main(const FString &Params) override;
+};
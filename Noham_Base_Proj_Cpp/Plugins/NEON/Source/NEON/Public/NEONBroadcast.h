@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONBroadcast.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "Windows/AllowWindowsPlatformTypes.h"
+THIRD_PARTY_INCLUDES_START
+#include "include/internal/cef_string.h"
+THIRD_PARTY_INCLUDES_END
+#include "Windows/HideWindowsPlatformTypes.h"
+
+class UNEONWidget;
+
+/**
+ * One published message, shared by every subscriber it is delivered to.
+ * The script is the same NEON_Bridge_Web_Invoke call InvokeWeb builds, with the topic as the method.
+ */
+struct FNEONTopicMessage
+{
+  FName Topic;
+  // Serialized payload before escaping, empty for Publish(Topic). Kept for FNEONBridgeRecorder.
+  FString Json;
+  FString Script;
+  // Pre-converted for ExecuteJavaScript, so widgets don't convert the script each
+  CefString CefScript;
+};
+
+using FNEONTopicMessageRef = TSharedRef<const FNEONTopicMessage, ESPMode::ThreadSafe>;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnNEONTopicSubscribed, FName /*Topic*/, UNEONWidget * /*Widget*/);
+
+/**
+ * Module wide pub/sub from Unreal to the pages of many NEON widgets (see FNEONModule::GetBroadcast).
+ *
+ * Widgets subscribe to topics. Publish serializes and escapes the payload once and hands the same message to every
+ * subscriber's outbound queue, which the widget flushes on its next tick. Subscribers that are hidden or frozen keep
+ * only the latest message per topic until they are visible again.
+ *
+ * On the page a topic arrives like any other InvokeWeb call: NEON.onInvoke('<Topic>', callback). Pages can also
+ * subscribe the widget showing them with NEON.subscribe('<Topic>', callback), for widgets that don't list the topic.
+ * Game thread only.
+ */
+class NEON_API FNEONBroadcast
+{
+public:
+  void Subscribe(UNEONWidget *Widget, FName Topic);
+  void Unsubscribe(UNEONWidget *Widget, FName Topic);
+  void UnsubscribeAll(UNEONWidget *Widget);
+
+  // Fired on every Subscribe, also for a widget that already was subscribed (e.g. a reloaded page). Publishers of
+  // state topics use it to send the current state to pages that subscribed after the last change.
+  FOnNEONTopicSubscribed OnSubscribed;
+
+  // Returns the number of widgets the message was delivered to
+  int32 Publish(FName Topic, const TSharedRef<FJsonObject> &JsonObject);
+  int32 Publish(FName Topic);
+
+  int32 GetSubscriberCount(FName Topic) const;
+
+  void Reset()
+  {
+    _Subscribers.Reset();
+    OnSubscribed.Clear();
+  }
+
+private:
+  int32 Deliver(FName Topic, const FString &Script, const FString &Json);
+
+  TMap<FName, TArray<TWeakObjectPtr<UNEONWidget>>> _Subscribers;
+};
@@ -8,19 +8,29 @@
 
 #include "Windows/AllowWindowsPlatformTypes.h"
 THIRD_PARTY_INCLUDES_START
+#include "include/cef_audio_handler.h"
 #include "include/cef_client.h"
+#include "include/cef_display_handler.h"
+#include "include/cef_load_handler.h"
+#include "include/cef_request_handler.h"
 #include "include/wrapper/cef_message_router.h"
 
 THIRD_PARTY_INCLUDES_END
 #include "Windows/HideWindowsPlatformTypes.h"
 
+#include "NEONAudioStream.h"
+
 class UNEONWidget;
 class NEONMessageHandler;
 
 class NEONClient
     : public CefClient,
       public CefLifeSpanHandler,
-      public CefRenderHandler
+      public CefRenderHandler,
+      public CefRequestHandler,
+      public CefLoadHandler,
+      public CefAudioHandler,
+      public CefDisplayHandler
 {
 public:
   NEONClient(NEONMessageHandler *MessageHandler);
@@ -29,6 +39,11 @@ public:
 
   CefRefPtr<CefRenderHandler> GetRenderHandler() override { return this; }
   CefRefPtr<CefLifeSpanHandler> GetLifeSpanHandler() override { return this; }
+  CefRefPtr<CefRequestHandler> GetRequestHandler() override { return this; }
+  CefRefPtr<CefLoadHandler> GetLoadHandler() override { return this; }
+  CefRefPtr<CefDisplayHandler> GetDisplayHandler() override { return this; }
+  // Without an audio handler Chromium plays through its own output device
+  CefRefPtr<CefAudioHandler> GetAudioHandler() override { return _RouteAudio ? this : nullptr; }
 
   bool OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
                                 CefRefPtr<CefFrame> frame,
@@ -75,13 +90,57 @@ public:
   }
   void SetWidget(UNEONWidget *Widget);
 
+  // Device scale factor reported to CEF. The view rect stays the same in DIP, only fewer pixels are painted.
+  void SetRenderScale(float RenderScale) { _RenderScale = RenderScale; }
+  float GetRenderScale() const { return _RenderScale; }
+
+  // REQUEST HANDLER
+  bool OnBeforeBrowse(CefRefPtr<CefBrowser> browser,
+                      CefRefPtr<CefFrame> frame,
+                      CefRefPtr<CefRequest> request,
+                      bool user_gesture,
+                      bool is_redirect) override;
+  bool OnRenderProcessUnresponsive(CefRefPtr<CefBrowser> browser,
+                                   CefRefPtr<CefUnresponsiveProcessCallback> callback) override;
+  void OnRenderProcessResponsive(CefRefPtr<CefBrowser> browser) override;
+  void OnRenderProcessTerminated(CefRefPtr<CefBrowser> browser,
+                                 TerminationStatus status,
+                                 int error_code,
+                                 const CefString &error_string) override;
+
+  // LOAD HANDLER
+  void OnLoadEnd(CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame, int httpStatusCode) override;
+
+  // DISPLAY HANDLER
+  bool OnCursorChange(CefRefPtr<CefBrowser> browser,
+                      CefCursorHandle cursor,
+                      cef_cursor_type_t type,
+                      const CefCursorInfo &custom_cursor_info) override;
+
+  // AUDIO HANDLER
+  bool GetAudioParameters(CefRefPtr<CefBrowser> browser, CefAudioParameters &params) override;
+  void OnAudioStreamStarted(CefRefPtr<CefBrowser> browser, const CefAudioParameters &params, int channels) override;
+  void OnAudioStreamPacket(CefRefPtr<CefBrowser> browser, const float **data, int frames, int64_t pts) override;
+  void OnAudioStreamStopped(CefRefPtr<CefBrowser> browser) override;
+  void OnAudioStreamError(CefRefPtr<CefBrowser> browser, const CefString &message) override;
+
+  TSharedPtr<FNEONAudioStream, ESPMode::ThreadSafe> GetAudioStream() const { return _AudioStream; }
+
 private:
+  // DevTools share this client, only the widget's own browser is reported to the widget
+  bool IsWidgetBrowser(CefRefPtr<CefBrowser> browser) const;
+
   CefRefPtr<CefMessageRouterBrowserSide> _MessageRouter;
   NEONMessageHandler *_MessageHandler;
   UNEONWidget *_Widget = nullptr;
 
+  // Packets arrive on CEF's audio capture thread and never touch the widget, see NEONAudioStream.h
+  bool _RouteAudio = true;
+  TSharedPtr<FNEONAudioStream, ESPMode::ThreadSafe> _AudioStream;
+
   int _Width = 2048;
   int _Height = 2048;
+  float _RenderScale = 1.0f;
 
   IMPLEMENT_REFCOUNTING(NEONClient);
 };
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONLatencyProbe.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Measures input-to-paint latency of one NEON widget.
+ *
+ * 1. Every first mouse button down (no chords, no double clicks) and key down sent to CEF gets a sequence number
+ *    and a timestamp (OnInput).
+ * 2. The page counts pointerdown/keydown events in the same order and, in the next requestAnimationFrame, echoes
+ *    the count back with a { type: "latency", sequence } query (NEON_Bridge_Latency in neon-ue-web).
+ * 3. The first OnAcceleratedPaint after the echo carries the frame that reacted to the input. Its arrival,
+ *    where the frame is handed to the render thread copy into the dynamic texture, ends the sample (OnPaint).
+ */
+class NEON_API FNEONLatencyProbe
+{
+public:
+  void Reset();
+
+  void OnInput();
+  void OnEcho(int32 Sequence);
+  void OnPaint();
+
+  /** Percentiles over the most recent samples in milliseconds. False while there are no samples. */
+  bool GetPercentiles(float &OutP50, float &OutP95, float &OutP99) const;
+
+  /** Push the current percentiles to stat NEON and, per widget, to the NEON CSV category. */
+  void Publish(const FString &WidgetName) const;
+
+private:
+  struct FPendingInput
+  {
+    int32 Sequence;
+    double Time;
+  };
+
+  // Inputs waiting for their echo, oldest first
+  TArray<FPendingInput> _Pending;
+  // Inputs echoed by the page, waiting for the next paint
+  TArray<double> _AwaitingPaint;
+
+  // Ring buffer of the most recent samples in milliseconds
+  TArray<float> _Samples;
+  int32 _NextSample = 0;
+
+  int32 _Sequence = 0;
+
+  float _P50 = 0.0f;
+  float _P95 = 0.0f;
+  float _P99 = 0.0f;
+
+  static constexpr int32 MaxPending = 64;
+  static constexpr int32 MaxSamples = 512;
+};
@@ -35,7 +35,20 @@ enum class ENEONErrorCode : uint8
   UnexpectedParameterType = 9,
   MissingParameter = 10
 };
-CefString GetErrorMessage(ENEONErrorCode ErrorCode);
+FString GetErrorMessage(ENEONErrorCode ErrorCode);
+
+/**
+ * Receives the result of a bridge query.
+ * NEONMessageHandler only answers through this interface, so queries can be dispatched without CEF (headless mode).
+ */
+class NEONBridgeResponder
+{
+public:
+  virtual ~NEONBridgeResponder() {}
+
+  virtual void Success(const FString &Response) = 0;
+  virtual void Failure(int32 ErrorCode, const FString &ErrorMessage) = 0;
+};
 
 class NEONMessageHandler : public CefMessageRouterBrowserSide::Handler
 {
@@ -53,12 +66,28 @@ public:
                bool Persistent,
                CefRefPtr<Callback> Callback) override;
 
-  bool InvokeFunction(FString Name, TSharedPtr<FJsonObject> JSON, CefRefPtr<Callback> Callback);
-  bool InvokeEvent(FString Name, TSharedPtr<FJsonObject> JSON, CefRefPtr<Callback> Callback);
+  /**
+   * Parse and dispatch a bridge request ({ type, delegate, parameters }) to the widget.
+   * OnQuery forwards here; headless widgets call it directly.
+   */
+  bool HandleQuery(const FString &Request, NEONBridgeResponder &Responder);
+
+  bool InvokeFunction(FString Name, TSharedPtr<FJsonObject> JSON, NEONBridgeResponder &Responder);
+  bool InvokeEvent(FString Name, TSharedPtr<FJsonObject> JSON, NEONBridgeResponder &Responder);
 
 protected:
-  bool BuildParamsBuffer(UFunction *DelegateFunction, TSharedPtr<FJsonObject> JSONIn, uint8 *ParamsBuffer, CefRefPtr<Callback> Callback);
+  bool InvokeFunction(UFunction *DelegateFunction, TSharedPtr<FJsonObject> JSON, NEONBridgeResponder &Responder);
+  bool InvokeEvent(UFunction *DelegateFunction, TSharedPtr<FJsonObject> JSON, NEONBridgeResponder &Responder);
+
+  UFunction *FindDelegate(uint32 DelegateId);
+
+  bool BuildParamsBuffer(UFunction *DelegateFunction, TSharedPtr<FJsonObject> JSONIn, uint8 *ParamsBuffer, NEONBridgeResponder &Responder);
+  void DestroyParamsBuffer(UFunction *DelegateFunction, uint8 *ParamsBuffer);
   FString GetJsonTypeAsString(EJson Type);
 
   UNEONWidget *_Widget;
+
+  // Binding id to delegate, see NEONBridgeBindings.h
+  TMap<uint32, UFunction *> _DispatchTable;
+  bool _DispatchTableBuilt = false;
 };
\ No newline at end of file
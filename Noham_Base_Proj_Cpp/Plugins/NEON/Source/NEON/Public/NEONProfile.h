@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONProfile.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A NEON profile describes the CEF process model and command line switches used when CEF is initialized.
+ * Profiles are read from the game config in sections named [NEON.Profile.<Name>]. The active profile is
+ * selected with -NEONProfile=<Name> on the command line or Profile=<Name> in the [NEON] section.
+ *
+ * Profiles are applied once in NEONApp::OnBeforeCommandLineProcessing, so switching requires a restart.
+ */
+struct NEON_API FNEONProfile
+{
+  FString Name = TEXT("Default");
+
+  // --renderer-process-limit, 0 leaves the Chromium default
+  int32 RendererProcessLimit = 0;
+
+  // false appends --disable-site-isolation-trials and disables strict origin isolation
+  bool bSiteIsolation = true;
+
+  bool bGpuRasterization = true;
+  bool bZeroCopy = false;
+  bool bGpuShaderDiskCache = true;
+
+  // --js-flags=--max-old-space-size=<MB>, 0 leaves the V8 default
+  int32 JsHeapLimitMB = 0;
+
+  // Additional V8 flags appended to --js-flags
+  FString JsFlags;
+
+  // false appends --disable-background-timer-throttling and --disable-renderer-backgrounding
+  bool bBackgroundTimerThrottling = true;
+
+  // Route page audio into the UE audio mixer (UNEONAudioComponent) and --mute-audio Chromium's own output
+  bool bRouteAudio = true;
+
+  /** Names of all built-in and configured profiles. */
+  static TArray<FString> GetProfileNames();
+
+  /** Name of the profile requested by command line or config, "Default" if none. */
+  static FString GetSelectedProfileName();
+
+  /**
+   * Resolve a profile by name. Built-in values are used as the base and overridden by the config section.
+   * Returns false (and leaves OutProfile as Default) if the name is unknown.
+   */
+  static bool LoadProfile(const FString &ProfileName, FNEONProfile &OutProfile);
+
+  FString ToString() const;
+};
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONProfileBenchmark.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FNEONProcessTotals;
+
+/**
+ * Records memory and frame cost of the active NEON profile.
+ *
+ * Profiles only take effect when CEF is initialized, so a benchmark over several profiles relaunches the game once
+ * per profile. Each run is started with -NEONProfile=<Name> -NEONProfileBenchmark=<Seconds> and the remaining
+ * profiles in -NEONProfileBenchmarkQueue=<A+B+C>. Results are appended to Saved/Profiling/NEON/ProfileBenchmark.csv.
+ * Memory is the sum over all CEF processes as polled by FNEONResourceMonitor, the game process is not included.
+ *
+ * Console: neon.profile.benchmark [Seconds] [Profile ...]
+ */
+class NEON_API FNEONProfileBenchmark
+{
+public:
+  /** Relaunch the game with the first profile and queue the rest. The current process exits. */
+  static void Launch(const TArray<FString> &ProfileNames, float Seconds);
+
+  /** Start sampling if this process was launched as a benchmark run. Call after CEF is initialized. */
+  void StartFromCommandLine(const FString &ProfileName);
+
+  bool IsRunning() const { return _IsRunning; }
+
+  /** Sample one world tick. PumpSeconds is the time spent in CefDoMessageLoopWork, Totals the last CEF process poll. */
+  void Tick(float DeltaSeconds, double PumpSeconds, const FNEONProcessTotals &Totals);
+
+private:
+  void Finish();
+
+  bool _IsRunning = false;
+  FString _ProfileName;
+  TArray<FString> _Queue;
+  float _Duration = 0.0f;
+  float _Elapsed = 0.0f;
+
+  // Samples are only taken after the warmup so page load and shader compilation don't skew the results
+  float _Warmup = 5.0f;
+
+  int64 _Frames = 0;
+  double _FrameSeconds = 0.0;
+  double _PumpSeconds = 0.0;
+  double _MaxPumpSeconds = 0.0;
+  int64 _MemorySamples = 0;
+  double _CefMemorySum = 0.0;
+  double _GpuProcessMemorySum = 0.0;
+  int64 _PeakCefMemory = 0;
+};
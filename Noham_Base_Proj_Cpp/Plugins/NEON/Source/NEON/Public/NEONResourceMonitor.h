@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONResourceMonitor.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "NEONResourceMonitor.generated.h"
+
+class UNEONWidget;
+
+/**
+ * Resource usage of the renderer process backing one NEON browser, as reported by CefTaskManager.
+ * Memory values are -1 while CEF has no measurement yet.
+ */
+USTRUCT(BlueprintType)
+struct NEON_API FNEONProcessStats
+{
+  GENERATED_BODY()
+
+  UPROPERTY(BlueprintReadOnly, Category = "NEON")
+  bool bValid = false;
+
+  UPROPERTY(BlueprintReadOnly, Category = "NEON")
+  int32 BrowserId = 0;
+
+  UPROPERTY(BlueprintReadOnly, Category = "NEON")
+  int64 TaskId = -1;
+
+  // Zero to number of processors * 100
+  UPROPERTY(BlueprintReadOnly, Category = "NEON")
+  float CpuUsage = 0.0f;
+
+  UPROPERTY(BlueprintReadOnly, Category = "NEON")
+  int64 MemoryBytes = -1;
+
+  UPROPERTY(BlueprintReadOnly, Category = "NEON")
+  int64 GpuMemoryBytes = -1;
+
+  float GetMemoryMB() const { return MemoryBytes > 0 ? static_cast<float>(MemoryBytes / (1024.0 * 1024.0)) : 0.0f; }
+};
+
+/**
+ * Memory of all CEF processes (browser, GPU, renderers, utilities) from the last poll.
+ */
+struct NEON_API FNEONProcessTotals
+{
+  bool bValid = false;
+  int32 Processes = 0;
+  int64 RendererMemoryBytes = 0;
+  int64 GpuProcessMemoryBytes = 0;
+  int64 OtherMemoryBytes = 0;
+
+  int64 GetMemoryBytes() const { return RendererMemoryBytes + GpuProcessMemoryBytes + OtherMemoryBytes; }
+};
+
+/**
+ * Polls CefTaskManager and hands per-browser renderer stats to the registered widgets.
+ * Totals for all CEF processes are published to "stat NEON".
+ *
+ * CefTaskManager may only be used on the CEF UI thread. NEON runs CEF with multi_threaded_message_loop = false,
+ * so the UI thread is the game thread and polling happens on a core ticker at [NEON] ResourceMonitorInterval
+ * seconds (0 disables the monitor).
+ */
+class NEON_API FNEONResourceMonitor
+{
+public:
+  void Start(float Interval);
+  void Stop();
+
+  bool IsRunning() const { return _TickerHandle.IsValid(); }
+
+  void RegisterWidget(UNEONWidget *Widget);
+  void UnregisterWidget(UNEONWidget *Widget);
+
+  const FNEONProcessTotals &GetTotals() const { return _Totals; }
+
+private:
+  bool Tick(float DeltaTime);
+
+  FTSTicker::FDelegateHandle _TickerHandle;
+  TArray<TWeakObjectPtr<UNEONWidget>> _Widgets;
+  FNEONProcessTotals _Totals;
+};
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONStats.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// stat NEON
+DECLARE_STATS_GROUP(TEXT("NEON"), STATGROUP_NEON, STATCAT_Advanced);
+
+// Timings
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Message Loop Pump"), STAT_NEON_Pump, STATGROUP_NEON, NEON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnAcceleratedPaint"), STAT_NEON_Paint, STATGROUP_NEON, NEON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Render Thread Copy"), STAT_NEON_RenderThreadCopy, STATGROUP_NEON, NEON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Decode"), STAT_NEON_QueryDecode, STATGROUP_NEON, NEON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query ProcessEvent"), STAT_NEON_ProcessEvent, STATGROUP_NEON, NEON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Response Encode"), STAT_NEON_ResponseEncode, STATGROUP_NEON, NEON_API);
+
+// Per frame counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Paints"), STAT_NEON_Paints, STATGROUP_NEON, NEON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Copied"), STAT_NEON_BytesCopied, STATGROUP_NEON, NEON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Queries"), STAT_NEON_Queries, STATGROUP_NEON, NEON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("InvokeWeb Calls"), STAT_NEON_InvokeWebCalls, STATGROUP_NEON, NEON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Topic Publishes"), STAT_NEON_TopicPublishes, STATGROUP_NEON, NEON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Topic Deliveries"), STAT_NEON_TopicDeliveries, STATGROUP_NEON, NEON_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Topic Messages Coalesced"), STAT_NEON_TopicCoalesced, STATGROUP_NEON, NEON_API);
+
+// World-space surfaces (see UNEONSurfaceSubsystem)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Surfaces"), STAT_NEON_LiveSurfaces, STATGROUP_NEON, NEON_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Frozen Surfaces"), STAT_NEON_FrozenSurfaces, STATGROUP_NEON, NEON_API);
+
+// Input-to-paint latency in ms of the last widget with an active probe (see NEONLatencyProbe.h)
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Input Latency P50 (ms)"), STAT_NEON_InputLatencyP50, STATGROUP_NEON, NEON_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Input Latency P95 (ms)"), STAT_NEON_InputLatencyP95, STATGROUP_NEON, NEON_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Input Latency P99 (ms)"), STAT_NEON_InputLatencyP99, STATGROUP_NEON, NEON_API);
+
+// The same timings and counters in CSV captures (csvprofile start/stop, -csvCaptureFrames)
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(NEON_API, NEON);
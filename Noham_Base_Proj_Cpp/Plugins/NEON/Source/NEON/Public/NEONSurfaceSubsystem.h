@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONSurfaceSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "NEONSurfaceSubsystem.generated.h"
+
+class UNEONWidgetComponent;
+
+/**
+ * Level of detail for all UNEONWidgetComponents of a world.
+ *
+ * Every tick the projected screen size of each surface is measured from the first local player's camera. Visible
+ * surfaces are ranked by priority, then by how recently they were visible, then by screen size. Only the first
+ * MaxLiveSurfaces keep a live browser. Everything else, and every surface that is offscreen or occluded, is frozen.
+ *
+ * The budget is read from [NEON] MaxLiveSurfaces in the game config (default 4).
+ */
+UCLASS()
+class NEON_API UNEONSurfaceSubsystem : public UTickableWorldSubsystem
+{
+  GENERATED_BODY()
+
+public:
+  virtual void Initialize(FSubsystemCollectionBase &Collection) override;
+  virtual void Tick(float DeltaTime) override;
+  virtual TStatId GetStatId() const override;
+
+  void RegisterSurface(UNEONWidgetComponent *Surface);
+  void UnregisterSurface(UNEONWidgetComponent *Surface);
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|LOD")
+  void SetMaxLiveSurfaces(int32 MaxLiveSurfaces) { _MaxLiveSurfaces = FMath::Max(MaxLiveSurfaces, 0); }
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|LOD")
+  int32 GetMaxLiveSurfaces() const { return _MaxLiveSurfaces; }
+
+protected:
+  virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+  TArray<TWeakObjectPtr<UNEONWidgetComponent>> _Surfaces;
+  int32 _MaxLiveSurfaces = 4;
+};
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONTrace.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Captures a Chromium trace of all CEF processes (cef_trace.h).
+ *
+ * The trace is written next to the active .utrace as <name>_<time>.neon.json, or to Saved/Profiling/NEON when Unreal
+ * Insights is not tracing to a file. Open it in chrome://tracing or ui.perfetto.dev.
+ *
+ * To line up both timelines, a "NEON.ClockSync" instant event is recorded in the Chromium trace when tracing has
+ * started and right before it stops. Its ue_cycles argument is FPlatformTime::Cycles64() at that moment. The
+ * same moment is bookmarked in Insights as "NEON.ClockSync <CEF trace time in us>".
+ *
+ * Console: neon.trace.start [categories], neon.trace.stop
+ */
+class NEON_API FNEONTrace
+{
+public:
+  static bool Start(const FString &Categories);
+  static bool Stop();
+
+  static bool IsTracing() { return _IsTracing; }
+
+  /** Record a clock sync marker in both the Chromium trace and Unreal Insights. */
+  static void MarkClockSync();
+
+private:
+  static FString GetTraceFilePath();
+
+  static bool _IsTracing;
+};
@@ -42,14 +42,21 @@ public:
    */
   virtual void OnAcceleratedPaint_View(HANDLE SharedHandle) = 0;
 
+  /**
+   * Popups (<select> dropdowns etc.) are copied into their own small texture, not into the main one.
+   * UNEONWidget draws it with GetPopupBrush above the browser image, so a popup repaint never touches the main view.
+   */
   virtual void OnAcceleratedPaint_View_Popup(HANDLE SharedHandle) = 0;
 
   bool IsPopupVisible() const { return _IsPopupVisible; }
-  virtual void SetPopupVisible(bool Visible) = 0;
+  // False from showing or resizing the popup until its first frame has been copied
+  bool HasPopupFrame() const { return _HasPopupFrame; }
+  void SetPopupVisible(bool Visible);
   const FVector2D &GetPopupPosition() const { return _PopupPosition; }
   void SetPopupPosition(const FVector2D &Position) { _PopupPosition = Position; }
   const FVector2D &GetPopupSize() const { return _PopupSize; }
-  void SetPopupSize(const FVector2D &Size) { _PopupSize = Size; }
+  // Recreates the popup texture when the size changed
+  void SetPopupSize(const FVector2D &Size);
 
   /**
    * SetWidgetSize is called on Tick with the current widget dimensions.
@@ -75,7 +82,13 @@ protected:
   FRHITexture *GetDynamicRHITexture();
 
   // Popup state
+  UTexture2D *_PopupTexture = nullptr;
+
+  // Null until the render thread has initialized the popup texture
+  FRHITexture *GetPopupRHITexture();
+
   bool _IsPopupVisible = false;
+  bool _HasPopupFrame = false;
   FVector2D _PopupPosition = FVector2D(0, 0);
   FVector2D _PopupSize = FVector2D(1024, 1024);
 };
\ No newline at end of file
@@ -32,8 +32,6 @@ public:
   virtual void OnAcceleratedPaint_View(HANDLE SharedHandle) override;
   virtual void OnAcceleratedPaint_View_Popup(HANDLE SharedHandle) override;
 
-  virtual void SetPopupVisible(bool Visible) override;
-
   bool TryCreateD3D11Device();
 
 private:
@@ -43,7 +41,4 @@ private:
   ComPtr<ID3D11DeviceContext> _D3D11Context;
   ComPtr<ID3D11DeviceContext1> _D3D11Context1;
   ID3D11DynamicRHI *_D3D11RHI = nullptr;
-
-  // Extra references for dynamic/popup textures
-  ComPtr<ID3D11Texture2D> _SharedResourcePopup_D3D11;
 };
@@ -29,8 +29,6 @@ public:
   virtual void OnAcceleratedPaint_View(HANDLE SharedHandle) override;
   virtual void OnAcceleratedPaint_View_Popup(HANDLE SharedHandle) override;
 
-  virtual void SetPopupVisible(bool Visible) override;
-
   bool TryCreateD3D12Device();
 
 private:
@@ -38,7 +36,4 @@ private:
   ComPtr<ID3D12Device> _D3D12Device;
   ComPtr<ID3D12CommandQueue> _D3D12CommandQueue;
   ID3D12DynamicRHI *_D3D12RHI = nullptr;
-
-  // For popup
-  ComPtr<ID3D12Resource> _SharedResourcePopup_D3D12;
 };
@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONView_Null.h
+
+#pragma once
+
+#include "NEONView.h"
+
+/**
+ * NEONView_Null is used when the NEON module runs headless (dedicated server, commandlet, -nullrhi).
+ * There is no browser, so nothing is ever painted. It only exists so UNEONWidget keeps a valid view.
+ */
+class NEONView_Null : public NEONView
+{
+public:
+  virtual ~NEONView_Null() override {}
+
+  virtual void OnAcceleratedPaint_View(HANDLE SharedHandle) override {}
+  virtual void OnAcceleratedPaint_View_Popup(HANDLE SharedHandle) override {}
+};
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024 Michael Saller - All Rights Reserved
+ * Published 2025 by TECHTILE media via FAB.com
+ */
+// NEONWidgetComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/WidgetComponent.h"
+
+#include "NEONWidgetComponent.generated.h"
+
+class UNEONWidget;
+
+/**
+ * A world-space NEON surface (terminals, screens). Use it like a UWidgetComponent with a UNEONWidget class.
+ *
+ * UNEONSurfaceSubsystem scales the browser with the projected screen size of the surface: the render scale and
+ * frame rate go down with distance. Surfaces that have not been rendered for _FreezeDelay (offscreen, occluded)
+ * and surfaces over the live budget are frozen: the browser is hidden and the last texture stays visible.
+ */
+UCLASS(ClassGroup = NEON, meta = (BlueprintSpawnableComponent))
+class NEON_API UNEONWidgetComponent : public UWidgetComponent
+{
+  GENERATED_BODY()
+
+public:
+  UNEONWidgetComponent(const FObjectInitializer &ObjectInitializer);
+
+  // Projected height, as a fraction of the viewport height, from which the surface gets full resolution and frame rate
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|LOD", meta = (ClampMin = "0.01", ClampMax = "1.0"))
+  float _FullDetailScreenSize = 0.5f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|LOD", meta = (ClampMin = "0.1", ClampMax = "1.0"))
+  float _MinRenderScale = 0.25f;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|LOD", meta = (ClampMin = "1"))
+  int32 _MinFrameRate = 10;
+
+  // Seconds a surface may go unrendered before its browser is frozen
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|LOD")
+  float _FreezeDelay = 0.5f;
+
+  // Surfaces with a higher priority stay live first when there are more visible surfaces than the budget allows
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|LOD")
+  int32 _Priority = 0;
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|LOD")
+  UNEONWidget *GetNEONWidget() const;
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|LOD")
+  float GetScreenSize() const { return _ScreenSize; }
+
+  bool IsOnScreen() const { return _IsOnScreen; }
+  double GetLastVisibleTime() const { return _LastVisibleTime; }
+
+  // Called by UNEONSurfaceSubsystem
+  void UpdateVisibility(const FVector &ViewLocation, float ViewHalfFOVTan, double Now);
+  void ApplyLOD(bool bLive, double Now);
+
+protected:
+  virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+  float _ScreenSize = 0.0f;
+  bool _IsOnScreen = false;
+  double _LastVisibleTime = -1.0;
+
+  float _RenderScale = 1.0f;
+  double _LastRenderScaleChange = 0.0;
+};
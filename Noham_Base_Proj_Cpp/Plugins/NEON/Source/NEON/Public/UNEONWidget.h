@@ -21,11 +21,36 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 #include "Windows/HideWindowsPlatformTypes.h"
 
+#include "NEONBridgeRecorder.h"
+#include "NEONBroadcast.h"
 #include "NEONClient.h"
+#include "NEONResourceMonitor.h"
+#include "NEONLatencyProbe.h"
 
 #include "UNEONWidget.generated.h"
 
 class NEONView;
+class UNEONAudioComponent;
+class USoundClass;
+class USoundSubmixBase;
+class NEONMessageHandler;
+
+// A cursor drawn by the widget instead of the OS (see UNEONWidget::_DrawSoftwareCursor)
+USTRUCT(BlueprintType)
+struct FNEONCursorStyle
+{
+  GENERATED_BODY()
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  FSlateBrush Brush;
+
+  // Click point relative to the top left of the brush, in slate units
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  FVector2D Hotspot = FVector2D::ZeroVector;
+};
+
+// Fired with every script sent to the page. In headless mode this is the only place the script goes.
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnNEONScriptExecuted, const FString &);
 
 UCLASS(BlueprintType, Blueprintable)
 class NEON_API UNEONWidget : public UUserWidget
@@ -63,16 +88,35 @@ protected:
   // The brush used by _BrowserImage
   FSlateBrush _TextureBrush;
 
+  // The popup texture (see NEONView::OnAcceleratedPaint_View_Popup), drawn in NativePaint
+  UPROPERTY(Transient)
+  FSlateBrush _PopupBrush;
+
   // Abstract NEONView pointer (either NEONView_11 or NEONView_12).
   NEONView *_View = nullptr;
 
   // Scale factor used for input transformations.
-  float _ScaleFactor;
+  float _ScaleFactor = 1.0f;
 
   // CEF references
   CefRefPtr<NEONClient> _Client;
   CefRefPtr<CefBrowser> _Browser;
 
+  // Owned by _Client, or by the widget itself when headless
+  NEONMessageHandler *_MessageHandler = nullptr;
+
+  // No CEF in this process (see FNEONModule::IsHeadless). Bridge calls still work, nothing is rendered.
+  bool _IsHeadless = false;
+
+  FNEONLatencyProbe _LatencyProbe;
+
+  FNEONProcessStats _ProcessStats;
+  bool _IsOverBudget = false;
+
+  // Send a script to the main frame. Headless widgets only broadcast OnScriptExecuted.
+  void ExecuteScript(const FString &Script);
+  void ExecuteScript(const FString &Script, const CefString &CefScript);
+
 public:
   // UMG
   UPROPERTY(BlueprintReadWrite, meta = (BindWidget), Category = "NEON")
@@ -105,6 +149,71 @@ public:
   UFUNCTION(BlueprintCallable, Category = "NEON")
   void SetMaxFPS(int MaxFPS);
 
+  // LATENCY PROBE
+  // Measure input-to-paint latency. The page needs the NEON_Bridge_Latency hook from neon-ue-web.
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  bool _MeasureInputLatency = false;
+
+  // Input-to-paint latency percentiles in milliseconds. False while there are no samples.
+  UFUNCTION(BlueprintCallable, Category = "NEON")
+  bool GetInputLatency(float &P50, float &P95, float &P99) const { return _LatencyProbe.GetPercentiles(P50, P95, P99); }
+
+  void HandleLatencyEcho(int32 Sequence);
+
+  // RENDERER RESOURCES (see FNEONResourceMonitor)
+  // Renderer memory above this fires OnRendererOverBudget. 0 disables the budget.
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  int32 _RendererMemoryBudgetMB = 0;
+
+  // Restart the browser (and with it the renderer process) when the budget is exceeded
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  bool _RecycleOverBudget = false;
+
+  UFUNCTION(BlueprintCallable, Category = "NEON")
+  FNEONProcessStats GetProcessStats() const { return _ProcessStats; }
+
+  UFUNCTION(BlueprintImplementableEvent, Category = "NEON")
+  void OnRendererOverBudget(const FNEONProcessStats &Stats);
+
+  void UpdateProcessStats(const FNEONProcessStats &Stats);
+
+  // CURSOR
+  // The page's cursor is mirrored into the widget's Slate cursor as soon as CEF reports it.
+  // With _DrawSoftwareCursor, cursor types that have a style are drawn by the widget at game frame rate and the OS
+  // cursor is hidden. This keeps the cursor smooth when the browser frame rate is low.
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|Cursor")
+  bool _DrawSoftwareCursor = false;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|Cursor")
+  TMap<TEnumAsByte<EMouseCursor::Type>, FNEONCursorStyle> _CursorStyles;
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|Cursor")
+  TEnumAsByte<EMouseCursor::Type> GetBrowserCursor() const { return _BrowserCursor; }
+
+  void HandleCursorChange(EMouseCursor::Type Cursor);
+
+  // LOD (driven by UNEONSurfaceSubsystem for world-space surfaces, see NEONWidgetComponent.h)
+  // RenderScale lowers the device scale factor, the page keeps its layout. FrameRate 0 leaves _MaxFPS.
+  // Frozen browsers are hidden (WasHidden) and keep showing their last texture.
+  void SetLOD(float RenderScale, int32 FrameRate, bool bFrozen);
+  float GetRenderScale() const { return _RenderScale; }
+  bool IsFrozen() const { return _IsFrozen; }
+
+  // AUDIO
+  // Page audio plays through the UE mixer when the NEON profile routes audio (bRouteAudio)
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|Audio")
+  USoundClass *_AudioSoundClass = nullptr;
+
+  // Usually the UI or SFX submix. None plays into the master submix.
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|Audio")
+  USoundSubmixBase *_AudioSubmix = nullptr;
+
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|Audio")
+  float _AudioVolume = 1.0f;
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|Audio")
+  void SetAudioVolume(float Volume);
+
 public:
   // INVOCATION
   UFUNCTION(BlueprintCallable, Category = "NEON")
@@ -125,9 +234,41 @@ public:
   UFUNCTION(BlueprintCallable, Category = "NEON")
   void InvokeWebString(const FString &Method, const FString &Value);
 
+  // - topics (see NEONBroadcast.h)
+  // Subscribed on construct. The page receives them with NEON.onInvoke('<Topic>', ...).
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON|Topics")
+  TArray<FName> _Topics;
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|Topics")
+  void SubscribeTopic(FName Topic);
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|Topics")
+  void UnsubscribeTopic(FName Topic);
+
+  // Serialize once and send to every widget subscribed to Topic. Returns the number of subscribers.
+  UFUNCTION(BlueprintCallable, Category = "NEON|Topics")
+  static int32 PublishTopic(FName Topic, const FJsonObjectWrapper &JsonObjectWrapper);
+
+  UFUNCTION(BlueprintCallable, Category = "NEON|Topics")
+  static int32 PublishTopicNoParam(FName Topic);
+
+  // Escape Value for a double quoted string literal in a NEON_Bridge_Web_Invoke script
+  static FString EscapeScriptString(const FString &Value);
+
+  // Called by FNEONBroadcast. Sent on the next tick, or coalesced to the latest per topic while hidden.
+  void EnqueueTopicMessage(const FNEONTopicMessageRef &Message);
+
   // - unreal
+  // Dispatch a bridge request as if it came from the page. Used for headless runs and tests.
   void InvokeUnreal(const FString &Data);
 
+  // Run without a browser like a headless widget, for commandlets that create widgets outside a widget tree
+  void SetHeadless() { _IsHeadless = true; }
+
+  FOnNEONScriptExecuted OnScriptExecuted;
+
+  bool IsHeadless() const { return _IsHeadless; }
+
   // LIFE CYCLE
   UFUNCTION(BlueprintImplementableEvent, Category = "NEON")
   void OnBrowserCreated();
@@ -135,12 +276,60 @@ public:
   UFUNCTION(BlueprintCallable, Category = "NEON")
   void RestartBrowser();
 
+  // RECOVERY
+  // Restart the browser when the renderer crashes or hangs
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  bool _AutoRecover = true;
+
+  // Seconds a hung renderer gets before it is terminated and recovered
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  float _UnresponsiveTimeout = 5.0f;
+
+  // Consecutive recoveries before giving up, 0 keeps trying. The delay between them doubles up to 30s.
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  int32 _MaxRecoveryAttempts = 5;
+
+  // Re-send the last InvokeWeb* call per method once the recovered page has loaded
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  bool _ReplayStateAfterRecovery = true;
+
+  // Queries from the page whose cefQuery round trip takes longer than this are logged
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NEON")
+  float _SlowQueryWarningMs = 50.0f;
+
+  UFUNCTION(BlueprintImplementableEvent, Category = "NEON")
+  void OnBrowserRecovered(const FString &Reason);
+
+  // cefQuery round trip as measured by the page, from the call to its success or failure callback.
+  // The page reports in batches about once a second, this is the average of the last batch.
+  UFUNCTION(BlueprintCallable, Category = "NEON")
+  float GetQueryRoundTripMs() const { return _QueryRoundTripMs; }
+
+  UFUNCTION(BlueprintCallable, Category = "NEON")
+  float GetMaxQueryRoundTripMs() const { return _MaxQueryRoundTripMs; }
+
+  // Game thread part of the last query: decoding, ProcessEvent and encoding the response
+  UFUNCTION(BlueprintCallable, Category = "NEON")
+  float GetLastQueryDispatchMs() const { return _LastQueryDispatchMs; }
+
+  UFUNCTION(BlueprintCallable, Category = "NEON")
+  float GetMaxQueryDispatchMs() const { return _MaxQueryDispatchMs; }
+
+  // Called by NEONClient / NEONMessageHandler
+  bool HandleRenderProcessUnresponsive(CefRefPtr<CefUnresponsiveProcessCallback> Callback);
+  void HandleRenderProcessResponsive();
+  void HandleRenderProcessTerminated(int32 Status);
+  void HandleMainFrameLoaded(int HttpStatusCode);
+  void RecordQueryDispatchTime(double Milliseconds);
+  void RecordQueryRoundTrips(int32 Count, double TotalMilliseconds, double MaxMilliseconds);
+
   // NATIVE INPUT
   virtual FReply NativeOnMouseButtonDown(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent) override;
   virtual FReply NativeOnMouseButtonUp(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent) override;
   virtual FReply NativeOnMouseButtonDoubleClick(const FGeometry &InGeometry, const FPointerEvent &InMouseEvent) override;
 
   virtual FReply NativeOnMouseMove(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent) override;
+  virtual void NativeOnMouseLeave(const FPointerEvent &MouseEvent) override;
   virtual FReply NativeOnMouseWheel(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent) override;
 
   virtual FReply NativeOnKeyDown(const FGeometry &MyGeometry, const FKeyEvent &InKeyEvent) override;
@@ -148,7 +337,7 @@ public:
   virtual FReply NativeOnKeyChar(const FGeometry &MyGeometry, const FCharacterEvent &InCharacterEvent) override;
 
   // CEF HANDLING
-  void HandleMouseButtonEvent(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent, bool bIsMouseUp);
+  void HandleMouseButtonEvent(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent, bool bIsMouseUp, bool bIsDoubleClick = false);
   void HandleMouseMoveEvent(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent);
   void HandleMouseWheelEvent(const FGeometry &MyGeometry, const FPointerEvent &MouseEvent);
   void HandleKeyEvent(const FKeyEvent &InKeyEvent, bool bIsKeyUp);
@@ -162,6 +351,7 @@ public:
   NEONClient *GetClient() const { return _Client.get(); }
   CefBrowser *GetBrowser() const { return _Browser.get(); }
   FSlateBrush &GetTextureBrush() { return _TextureBrush; }
+  FSlateBrush &GetPopupBrush() { return _PopupBrush; }
 
   // POPUP
   UFUNCTION(BlueprintCallable, Category = "NEON")
@@ -172,4 +362,54 @@ public:
 
 protected:
   void CreateBrowser();
+
+  // Send a NEON_Bridge_Web_Invoke script and remember it for replay after recovery
+  // Kind and Value are the unencoded call, for FNEONBridgeRecorder
+  void ExecuteInvocation(const FString &Method, const FString &Script, FNEONBridgeRecorder::EInvocationKind Kind, const FString &Value);
+
+  void RecoverBrowser(const FString &Reason);
+
+  bool IsHiddenForTopics() const;
+  void FlushTopicMessages();
+
+  TArray<FNEONTopicMessageRef> _TopicQueue;
+  TMap<FName, FNEONTopicMessageRef> _LatestTopicMessages;
+  // GFrameCounter of the last NativeTick/NativePaint. Slate skips both for widgets under a collapsed parent or
+  // outside the viewport, which IsVisible() alone does not see.
+  mutable uint64 _LastShownFrame = 0;
+
+  CefRefPtr<CefUnresponsiveProcessCallback> _UnresponsiveCallback;
+  FTimerHandle _UnresponsiveTimerHandle;
+  FTimerHandle _RecoveryTimerHandle;
+  double _LastRecoveryTime = -1.0;
+  int32 _RecoveryAttempts = 0;
+  bool _PendingReplay = false;
+  TMap<FString, FString> _LastInvocations;
+
+  float _QueryRoundTripMs = 0.0f;
+  float _MaxQueryRoundTripMs = 0.0f;
+  float _LastQueryDispatchMs = 0.0f;
+  float _MaxQueryDispatchMs = 0.0f;
+
+  void ApplyFrameRate();
+
+  virtual int32 NativePaint(const FPaintArgs &Args, const FGeometry &AllottedGeometry, const FSlateRect &MyCullingRect,
+                            FSlateWindowElementList &OutDrawElements, int32 LayerId, const FWidgetStyle &InWidgetStyle,
+                            bool bParentEnabled) const override;
+
+  EMouseCursor::Type _BrowserCursor = EMouseCursor::Default;
+  FVector2D _CursorPosition = FVector2D::ZeroVector;
+  bool _IsCursorInside = false;
+
+  float _RenderScale = 1.0f;
+  int32 _LODFrameRate = 0;
+  bool _IsFrozen = false;
+
+  // Start, stop or recreate the audio component when the client's stream changed
+  void UpdateAudio();
+  void DestroyAudio();
+
+  UPROPERTY(Transient)
+  UNEONAudioComponent *_AudioComponent = nullptr;
+  uint32 _AudioGeneration = 0;
 };
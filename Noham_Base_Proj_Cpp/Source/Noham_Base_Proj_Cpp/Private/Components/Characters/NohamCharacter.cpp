@@ -61,7 +61,12 @@ void ANohamCharacter::BeginPlay()
 	if (UGameInstance* GameInstance = GetGameInstance())
 	{
 		SettingsSubsystem = GameInstance->GetSubsystem<UNohamSettingsSubsystem>();
-		if (!SettingsSubsystem)
+		if (SettingsSubsystem)
+		{
+			CacheInputSettings(SettingsSubsystem->GetInputSettings());
+			SettingsSubsystem->OnInputSettingsChanged.AddDynamic(this, &ANohamCharacter::HandleInputSettingsChanged);
+		}
+		else
 		{
 			UE_LOG(LogNohamCharacter, Warning, TEXT("Failed to get NohamSettingsSubsystem in BeginPlay"));
 		}
@@ -86,6 +91,16 @@ void ANohamCharacter::BeginPlay()
 	}
 }
 
+void ANohamCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (SettingsSubsystem)
+	{
+		SettingsSubsystem->OnInputSettingsChanged.RemoveDynamic(this, &ANohamCharacter::HandleInputSettingsChanged);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ANohamCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -205,11 +220,10 @@ void ANohamCharacter::Look(const FInputActionValue& Value)
 		bool bInvertY = ShouldInvertMouseY();
 
 		// Apply ADS sensitivity multiplier if aiming
-		if (bIsAiming && SettingsSubsystem)
+		if (bIsAiming)
 		{
-			float ADSMultiplier = SettingsSubsystem->GetInputSettings().ADSSensitivityMultiplier;
-			SensitivityX *= ADSMultiplier;
-			SensitivityY *= ADSMultiplier;
+			SensitivityX *= CachedADSSensitivityMultiplier;
+			SensitivityY *= CachedADSSensitivityMultiplier;
 		}
 
 		// Apply sensitivity scaling
@@ -314,31 +328,17 @@ bool ANohamCharacter::CheckCameraCollision(const FVector& DesiredLocation, FVect
 }
 
 // Settings integration helpers
-float ANohamCharacter::GetMouseSensitivityX() const
-{
-	if (SettingsSubsystem)
-	{
-		return SettingsSubsystem->GetInputSettings().MouseSensitivityX;
-	}
-	return 1.0f; // Default sensitivity
-}
-
-float ANohamCharacter::GetMouseSensitivityY() const
+void ANohamCharacter::HandleInputSettingsChanged(const FNohamInputSettings& OldSettings, const FNohamInputSettings& NewSettings)
 {
-	if (SettingsSubsystem)
-	{
-		return SettingsSubsystem->GetInputSettings().MouseSensitivityY;
-	}
-	return 1.0f; // Default sensitivity
+	CacheInputSettings(NewSettings);
 }
 
-bool ANohamCharacter::ShouldInvertMouseY() const
+void ANohamCharacter::CacheInputSettings(const FNohamInputSettings& Settings)
 {
-	if (SettingsSubsystem)
-	{
-		return SettingsSubsystem->GetInputSettings().bInvertMouseY;
-	}
-	return false; // Default not inverted
+	CachedMouseSensitivityX = Settings.MouseSensitivityX;
+	CachedMouseSensitivityY = Settings.MouseSensitivityY;
+	CachedADSSensitivityMultiplier = Settings.ADSSensitivityMultiplier;
+	bCachedInvertMouseY = Settings.bInvertMouseY;
 }
 
 void ANohamCharacter::SetMovementSpeedMultiplier(float NewMultiplier)
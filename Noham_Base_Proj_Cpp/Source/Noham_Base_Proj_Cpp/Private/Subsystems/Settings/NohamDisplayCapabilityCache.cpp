@@ -0,0 +1,94 @@
+// Copyright Noham Studios. All Rights Reserved.
+
+#include "Subsystems/Settings/NohamDisplayCapabilityCache.h"
+#include "Async/Async.h"
+#include "GenericPlatform/GenericApplication.h"
+#include "RHI.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNohamDisplayCapabilities, Log, All);
+
+void FNohamDisplayCapabilityCache::Rebuild()
+{
+	// Replacing the future drops the result of a build that is still running, it describes the old setup
+	PendingCapabilities = Async(EAsyncExecution::ThreadPool, &FNohamDisplayCapabilityCache::Build);
+}
+
+bool FNohamDisplayCapabilityCache::Poll()
+{
+	if (!PendingCapabilities.IsValid() || !PendingCapabilities.IsReady())
+	{
+		return false;
+	}
+
+	Capabilities = PendingCapabilities.Get();
+	Capabilities.Revision = NextRevision++;
+	PendingCapabilities.Reset();
+
+	UE_LOG(LogNohamDisplayCapabilities, Log, TEXT("Display capabilities: %d modes, %d monitors, HDR %s"),
+		Capabilities.DisplayModes.Num(), Capabilities.Monitors.Num(), Capabilities.bHDRSupported ? TEXT("supported") : TEXT("not supported"));
+	return true;
+}
+
+const FNohamDisplayCapabilities& FNohamDisplayCapabilityCache::Get()
+{
+	if (PendingCapabilities.IsValid())
+	{
+		PendingCapabilities.Wait();
+		Poll();
+	}
+	return Capabilities;
+}
+
+FNohamDisplayCapabilities FNohamDisplayCapabilityCache::Build()
+{
+	FNohamDisplayCapabilities Result;
+	Result.AdapterName = GRHIAdapterName;
+	Result.bHDRSupported = GRHISupportsHDROutput;
+
+	// Fullscreen modes of the adapter's outputs, one entry per refresh rate
+	FScreenResolutionArray ResolutionArray;
+	if (RHIGetAvailableResolutions(ResolutionArray, false))
+	{
+		for (const FScreenResolutionRHI& Resolution : ResolutionArray)
+		{
+			FNohamDisplayMode Mode;
+			Mode.Resolution = FIntPoint(Resolution.Width, Resolution.Height);
+			Mode.RefreshRate = Resolution.RefreshRate;
+			Result.DisplayModes.AddUnique(Mode);
+			Result.Resolutions.AddUnique(Mode.Resolution);
+			if (Mode.RefreshRate > 0)
+			{
+				Result.RefreshRates.AddUnique(Mode.RefreshRate);
+			}
+		}
+	}
+
+	Result.DisplayModes.Sort([](const FNohamDisplayMode& A, const FNohamDisplayMode& B)
+	{
+		const int64 PixelsA = (int64)A.Resolution.X * A.Resolution.Y;
+		const int64 PixelsB = (int64)B.Resolution.X * B.Resolution.Y;
+		return PixelsA != PixelsB ? PixelsA > PixelsB : A.RefreshRate > B.RefreshRate;
+	});
+	Result.Resolutions.Sort([](const FIntPoint& A, const FIntPoint& B)
+	{
+		return (int64)A.X * A.Y > (int64)B.X * B.Y;
+	});
+	Result.RefreshRates.Sort(TGreater<int32>());
+
+	FDisplayMetrics DisplayMetrics;
+	FDisplayMetrics::RebuildDisplayMetrics(DisplayMetrics);
+	for (const FMonitorInfo& MonitorInfo : DisplayMetrics.MonitorInfo)
+	{
+		FNohamMonitorInfo& Monitor = Result.Monitors.AddDefaulted_GetRef();
+		Monitor.Name = MonitorInfo.Name;
+		Monitor.Id = MonitorInfo.ID;
+		Monitor.NativeResolution = FIntPoint(MonitorInfo.NativeWidth, MonitorInfo.NativeHeight);
+		Monitor.MaxResolution = MonitorInfo.MaxResolution;
+		Monitor.Position = FIntPoint(MonitorInfo.DisplayRect.Left, MonitorInfo.DisplayRect.Top);
+		Monitor.DPI = MonitorInfo.DPI;
+		Monitor.bIsPrimary = MonitorInfo.bIsPrimary;
+	}
+
+	Result.Timestamp = FDateTime::UtcNow();
+	return Result;
+}
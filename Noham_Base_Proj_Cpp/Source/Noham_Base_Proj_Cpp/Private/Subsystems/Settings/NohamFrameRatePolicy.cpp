@@ -0,0 +1,65 @@
+// Copyright Noham Studios. All Rights Reserved.
+
+#include "Subsystems/Settings/NohamFrameRatePolicy.h"
+#include "Engine/Engine.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNohamFrameRatePolicy, Log, All);
+
+void FNohamFrameRatePolicy::SetCaps(const FCaps& InCaps)
+{
+	Caps = InCaps;
+	Apply();
+}
+
+void FNohamFrameRatePolicy::SetFocused(bool bInFocused)
+{
+	bFocused = bInFocused;
+	Apply();
+}
+
+void FNohamFrameRatePolicy::SetMenuOpen(bool bInMenuOpen)
+{
+	bMenuOpen = bInMenuOpen;
+	Apply();
+}
+
+ENohamFrameRateState FNohamFrameRatePolicy::GetState() const
+{
+	if (!bFocused)
+	{
+		return ENohamFrameRateState::Background;
+	}
+	return bMenuOpen ? ENohamFrameRateState::Menu : ENohamFrameRateState::Gameplay;
+}
+
+int32 FNohamFrameRatePolicy::GetActiveLimit() const
+{
+	int32 StateLimit = 0;
+	switch (GetState())
+	{
+	case ENohamFrameRateState::Background: StateLimit = Caps.Background; break;
+	case ENohamFrameRateState::Menu: StateLimit = Caps.Menu; break;
+	default: break;
+	}
+
+	if (StateLimit <= 0)
+	{
+		return Caps.Gameplay;
+	}
+	return Caps.Gameplay > 0 ? FMath::Min(StateLimit, Caps.Gameplay) : StateLimit;
+}
+
+void FNohamFrameRatePolicy::Apply(bool bForce)
+{
+	const int32 Limit = GetActiveLimit();
+	if (!GEngine || (!bForce && Limit == AppliedLimit))
+	{
+		return;
+	}
+
+	GEngine->SetMaxFPS((float)Limit);
+	AppliedLimit = Limit;
+
+	UE_LOG(LogNohamFrameRatePolicy, Verbose, TEXT("Frame rate cap %d (%s)"), Limit,
+		*StaticEnum<ENohamFrameRateState>()->GetNameStringByValue((int64)GetState()));
+}
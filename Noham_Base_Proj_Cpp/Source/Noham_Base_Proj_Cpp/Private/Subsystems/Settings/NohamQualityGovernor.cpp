@@ -0,0 +1,285 @@
+// Copyright Noham Studios. All Rights Reserved.
+
+#include "Subsystems/Settings/NohamQualityGovernor.h"
+#include "RHI.h"
+#include "RenderCore.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNohamQualityGovernor, Log, All);
+
+CSV_DEFINE_CATEGORY(NohamAdaptiveQuality, true);
+
+namespace NohamQualityGovernor
+{
+	// Band around the target frame time, inside it nothing changes
+	constexpr float OverBudgetRatio = 1.05f;
+	constexpr float UnderBudgetRatio = 0.85f;
+
+	// Dropping quality reacts fast, raising it again waits for a stable surplus
+	constexpr float StepDownDelay = 0.25f;
+	constexpr float StepUpDelay = 2.0f;
+	// Lets the smoothed times catch up with the previous step
+	constexpr float StepCooldown = 0.5f;
+
+	constexpr float SmoothingFactor = 0.1f;
+
+	// Screen percentage steps, down steps are proportional to the GPU overshoot within these limits
+	constexpr float MinResolutionStep = 2.5f;
+	constexpr float MaxResolutionStep = 10.0f;
+	constexpr float ResolutionStepUp = 5.0f;
+
+	// Stepped down in this order when GPU bound, restored in reverse. Textures and anti-aliasing are left alone,
+	// they cost memory and image stability rather than frame time.
+	int32 Scalability::FQualityLevels::* const Groups[] =
+	{
+		&Scalability::FQualityLevels::ShadowQuality,
+		&Scalability::FQualityLevels::GlobalIlluminationQuality,
+		&Scalability::FQualityLevels::ReflectionQuality,
+		&Scalability::FQualityLevels::PostProcessQuality,
+		&Scalability::FQualityLevels::EffectsQuality,
+		&Scalability::FQualityLevels::FoliageQuality,
+		&Scalability::FQualityLevels::ShadingQuality,
+		&Scalability::FQualityLevels::ViewDistanceQuality,
+	};
+
+	// Stepped down in this order when render thread bound: the groups that change how many primitives are drawn.
+	// The others mostly cost GPU time and would not help.
+	int32 Scalability::FQualityLevels::* const RenderThreadGroups[] =
+	{
+		&Scalability::FQualityLevels::ViewDistanceQuality,
+		&Scalability::FQualityLevels::FoliageQuality,
+		&Scalability::FQualityLevels::ShadowQuality,
+	};
+
+	bool LowerFirstGroup(Scalability::FQualityLevels& Levels, int32 Scalability::FQualityLevels::* const* InGroups, int32 NumGroups)
+	{
+		for (int32 Group = 0; Group < NumGroups; ++Group)
+		{
+			int32& Level = Levels.*InGroups[Group];
+			if (Level > 0)
+			{
+				--Level;
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+void FNohamQualityGovernor::Start(const FConfig& InConfig)
+{
+	Config = InConfig;
+	Levels = Scalability::GetQualityLevels();
+	MaxLevels = Levels;
+	Levels.ResolutionQuality = FMath::Clamp(Levels.ResolutionQuality, Config.MinResolutionScale, Config.MaxResolutionScale);
+
+	bRunning = true;
+	ResetHysteresis();
+	Stats.CurrentResolutionScale = Levels.ResolutionQuality;
+	Stats.GroupsReduced = 0;
+
+	UE_LOG(LogNohamQualityGovernor, Log, TEXT("Adaptive quality started: target %.2f ms, resolution %.0f-%.0f"),
+		Config.TargetFrameTimeMs, Config.MinResolutionScale, Config.MaxResolutionScale);
+}
+
+void FNohamQualityGovernor::Stop()
+{
+	if (bRunning)
+	{
+		UE_LOG(LogNohamQualityGovernor, Log, TEXT("Adaptive quality stopped"));
+	}
+	bRunning = false;
+}
+
+void FNohamQualityGovernor::SetLocked(bool bInLocked)
+{
+	bLocked = bInLocked;
+	ResetHysteresis();
+}
+
+void FNohamQualityGovernor::ResetStats()
+{
+	const float CurrentResolutionScale = Stats.CurrentResolutionScale;
+	const int32 GroupsReduced = Stats.GroupsReduced;
+	Stats = FNohamAdaptiveQualityStats();
+	Stats.CurrentResolutionScale = CurrentResolutionScale;
+	Stats.GroupsReduced = GroupsReduced;
+}
+
+void FNohamQualityGovernor::ResetHysteresis()
+{
+	OverBudgetTime = 0.0f;
+	UnderBudgetTime = 0.0f;
+	Cooldown = NohamQualityGovernor::StepCooldown;
+}
+
+void FNohamQualityGovernor::Tick(float DeltaTime)
+{
+	using namespace NohamQualityGovernor;
+
+	if (!bRunning || bLocked)
+	{
+		return;
+	}
+
+	// Same sources as stat unit
+	const float GPUTime = FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles());
+	const float GameThreadTime = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	const float RenderThreadTime = FPlatformTime::ToMilliseconds(GRenderThreadTime);
+
+	if (Stats.FramesEvaluated == 0)
+	{
+		Stats.SmoothedGPUTimeMs = GPUTime;
+		Stats.SmoothedGameThreadTimeMs = GameThreadTime;
+		Stats.SmoothedRenderThreadTimeMs = RenderThreadTime;
+	}
+	else
+	{
+		Stats.SmoothedGPUTimeMs = FMath::Lerp(Stats.SmoothedGPUTimeMs, GPUTime, SmoothingFactor);
+		Stats.SmoothedGameThreadTimeMs = FMath::Lerp(Stats.SmoothedGameThreadTimeMs, GameThreadTime, SmoothingFactor);
+		Stats.SmoothedRenderThreadTimeMs = FMath::Lerp(Stats.SmoothedRenderThreadTimeMs, RenderThreadTime, SmoothingFactor);
+	}
+
+	const float FrameTime = FMath::Max3(Stats.SmoothedGPUTimeMs, Stats.SmoothedGameThreadTimeMs, Stats.SmoothedRenderThreadTimeMs);
+	EBottleneck Bottleneck = EBottleneck::GPU;
+	if (Stats.SmoothedGameThreadTimeMs >= FrameTime)
+	{
+		Bottleneck = EBottleneck::GameThread;
+	}
+	else if (Stats.SmoothedRenderThreadTimeMs >= FrameTime)
+	{
+		Bottleneck = EBottleneck::RenderThread;
+	}
+
+	++Stats.FramesEvaluated;
+	if (FrameTime > Config.TargetFrameTimeMs)
+	{
+		++Stats.FramesOverTarget;
+		if (Bottleneck == EBottleneck::GameThread)
+		{
+			++Stats.FramesGameThreadBound;
+			CSV_CUSTOM_STAT(NohamAdaptiveQuality, GameThreadBound, 1, ECsvCustomStatOp::Accumulate);
+		}
+	}
+
+	CSV_CUSTOM_STAT(NohamAdaptiveQuality, ResolutionScale, Levels.ResolutionQuality, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(NohamAdaptiveQuality, GroupsReduced, Stats.GroupsReduced, ECsvCustomStatOp::Set);
+
+	if (FrameTime > Config.TargetFrameTimeMs * OverBudgetRatio)
+	{
+		OverBudgetTime += DeltaTime;
+		UnderBudgetTime = 0.0f;
+	}
+	else if (FrameTime < Config.TargetFrameTimeMs * UnderBudgetRatio)
+	{
+		UnderBudgetTime += DeltaTime;
+		OverBudgetTime = 0.0f;
+	}
+	else
+	{
+		OverBudgetTime = 0.0f;
+		UnderBudgetTime = 0.0f;
+	}
+
+	Cooldown -= DeltaTime;
+	if (Cooldown > 0.0f)
+	{
+		return;
+	}
+
+	if (OverBudgetTime >= StepDownDelay)
+	{
+		StepDown(Bottleneck);
+		ResetHysteresis();
+	}
+	else if (UnderBudgetTime >= StepUpDelay)
+	{
+		StepUp();
+		ResetHysteresis();
+	}
+}
+
+void FNohamQualityGovernor::StepDown(EBottleneck Bottleneck)
+{
+	using namespace NohamQualityGovernor;
+
+	// Lowering quality would only cost image quality, the frame stays as long
+	if (Bottleneck == EBottleneck::GameThread)
+	{
+		UE_LOG(LogNohamQualityGovernor, Verbose, TEXT("Adaptive quality: game thread bound (%.2f ms), nothing to lower"),
+			Stats.SmoothedGameThreadTimeMs);
+		return;
+	}
+
+	if (Bottleneck == EBottleneck::RenderThread)
+	{
+		if (LowerFirstGroup(Levels, RenderThreadGroups, UE_ARRAY_COUNT(RenderThreadGroups)))
+		{
+			++Stats.GroupDecreases;
+			ApplyLevels();
+		}
+		return;
+	}
+
+	// Pixel cost scales with the square of the screen percentage
+	if (Levels.ResolutionQuality > Config.MinResolutionScale)
+	{
+		const float Ideal = Levels.ResolutionQuality * FMath::Sqrt(Config.TargetFrameTimeMs / FMath::Max(Stats.SmoothedGPUTimeMs, KINDA_SMALL_NUMBER));
+		const float Step = FMath::Clamp(Levels.ResolutionQuality - Ideal, MinResolutionStep, MaxResolutionStep);
+		Levels.ResolutionQuality = FMath::Max(Levels.ResolutionQuality - Step, Config.MinResolutionScale);
+		++Stats.ResolutionDecreases;
+		ApplyLevels();
+		return;
+	}
+
+	if (LowerFirstGroup(Levels, Groups, UE_ARRAY_COUNT(Groups)))
+	{
+		++Stats.GroupDecreases;
+		ApplyLevels();
+	}
+
+	// Otherwise everything is at the floor, nothing left to give
+}
+
+void FNohamQualityGovernor::StepUp()
+{
+	using namespace NohamQualityGovernor;
+
+	for (int32 Group = UE_ARRAY_COUNT(Groups) - 1; Group >= 0; --Group)
+	{
+		int32& Level = Levels.*Groups[Group];
+		if (Level < MaxLevels.*Groups[Group])
+		{
+			++Level;
+			++Stats.GroupIncreases;
+			ApplyLevels();
+			return;
+		}
+	}
+
+	if (Levels.ResolutionQuality < Config.MaxResolutionScale)
+	{
+		Levels.ResolutionQuality = FMath::Min(Levels.ResolutionQuality + ResolutionStepUp, Config.MaxResolutionScale);
+		++Stats.ResolutionIncreases;
+		ApplyLevels();
+	}
+}
+
+void FNohamQualityGovernor::ApplyLevels()
+{
+	using namespace NohamQualityGovernor;
+
+	Scalability::SetQualityLevels(Levels);
+
+	int32 GroupsReduced = 0;
+	for (int32 Group = 0; Group < UE_ARRAY_COUNT(Groups); ++Group)
+	{
+		GroupsReduced += Levels.*Groups[Group] < MaxLevels.*Groups[Group] ? 1 : 0;
+	}
+	Stats.GroupsReduced = GroupsReduced;
+	Stats.CurrentResolutionScale = Levels.ResolutionQuality;
+
+	CSV_CUSTOM_STAT(NohamAdaptiveQuality, Adjustments, 1, ECsvCustomStatOp::Accumulate);
+	UE_LOG(LogNohamQualityGovernor, Verbose, TEXT("Adaptive quality: resolution %.1f, %d groups reduced (GPU %.2f ms, GT %.2f ms, RT %.2f ms)"),
+		Levels.ResolutionQuality, GroupsReduced, Stats.SmoothedGPUTimeMs, Stats.SmoothedGameThreadTimeMs, Stats.SmoothedRenderThreadTimeMs);
+}
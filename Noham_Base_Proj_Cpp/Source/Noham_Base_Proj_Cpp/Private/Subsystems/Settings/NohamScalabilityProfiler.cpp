@@ -0,0 +1,165 @@
+// Copyright Noham Studios. All Rights Reserved.
+
+#include "Subsystems/Settings/NohamScalabilityProfiler.h"
+#include "RHI.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNohamScalabilityProfiler, Log, All);
+
+namespace NohamScalabilityProfiler
+{
+	// Frames after a switch that are not measured: shader and PSO compiles, streaming, temporal history
+	constexpr int32 SettleFrames = 10;
+	constexpr int32 SampleFrames = 30;
+
+	// Epic is the highest level the settings expose
+	constexpr int32 NumLevels = 4;
+}
+
+int32& FNohamScalabilityProfiler::GetGroupLevel(Scalability::FQualityLevels& Levels, ENohamScalabilityGroup Group)
+{
+	switch (Group)
+	{
+	case ENohamScalabilityGroup::Shadows: return Levels.ShadowQuality;
+	case ENohamScalabilityGroup::Textures: return Levels.TextureQuality;
+	case ENohamScalabilityGroup::Effects: return Levels.EffectsQuality;
+	case ENohamScalabilityGroup::PostProcess: return Levels.PostProcessQuality;
+	case ENohamScalabilityGroup::Foliage: return Levels.FoliageQuality;
+	case ENohamScalabilityGroup::ViewDistance: return Levels.ViewDistanceQuality;
+	case ENohamScalabilityGroup::AntiAliasing: return Levels.AntiAliasingQuality;
+	case ENohamScalabilityGroup::GlobalIllumination: return Levels.GlobalIlluminationQuality;
+	case ENohamScalabilityGroup::Reflections: return Levels.ReflectionQuality;
+	default:
+		checkNoEntry();
+		return Levels.ShadowQuality;
+	}
+}
+
+void FNohamScalabilityProfiler::Start()
+{
+	using namespace NohamScalabilityProfiler;
+
+	if (bRunning)
+	{
+		return;
+	}
+
+	OriginalLevels = Scalability::GetQualityLevels();
+
+	Results = FNohamScalabilityCostEstimates();
+	Results.ProfiledResolutionScale = OriginalLevels.ResolutionQuality;
+
+	Steps.Reset();
+	Steps.Add(FStep());
+	for (int32 GroupIndex = 0; GroupIndex < (int32)ENohamScalabilityGroup::MAX; ++GroupIndex)
+	{
+		const ENohamScalabilityGroup Group = (ENohamScalabilityGroup)GroupIndex;
+		const int32 OriginalLevel = GetGroupLevel(OriginalLevels, Group);
+
+		FNohamScalabilityGroupCost& Cost = Results.Groups.AddDefaulted_GetRef();
+		Cost.Group = Group;
+		Cost.BaselineLevel = OriginalLevel;
+		Cost.GPUTimeMs.Init(-1.0f, NumLevels);
+
+		// The original level is the baseline, measured once for all groups
+		for (int32 Level = 0; Level < NumLevels; ++Level)
+		{
+			if (Level != OriginalLevel)
+			{
+				Steps.Add({ GroupIndex, Level });
+			}
+		}
+	}
+
+	bRunning = true;
+	StepIndex = 0;
+	BeginStep();
+
+	UE_LOG(LogNohamScalabilityProfiler, Log, TEXT("Scalability profiling started, %d steps"), Steps.Num());
+}
+
+void FNohamScalabilityProfiler::Cancel()
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	bRunning = false;
+	Scalability::SetQualityLevels(OriginalLevels);
+	UE_LOG(LogNohamScalabilityProfiler, Log, TEXT("Scalability profiling cancelled"));
+}
+
+void FNohamScalabilityProfiler::BeginStep()
+{
+	Scalability::FQualityLevels Levels = OriginalLevels;
+	const FStep& Step = Steps[StepIndex];
+	if (Step.GroupIndex != INDEX_NONE)
+	{
+		GetGroupLevel(Levels, (ENohamScalabilityGroup)Step.GroupIndex) = Step.Level;
+	}
+	Scalability::SetQualityLevels(Levels);
+
+	FramesInStep = 0;
+	Samples.Reset();
+}
+
+bool FNohamScalabilityProfiler::Tick(float DeltaTime)
+{
+	using namespace NohamScalabilityProfiler;
+
+	if (!bRunning)
+	{
+		return false;
+	}
+
+	if (++FramesInStep <= SettleFrames)
+	{
+		return false;
+	}
+
+	Samples.Add(FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles()));
+	if (Samples.Num() < SampleFrames)
+	{
+		return false;
+	}
+
+	FinishStep();
+
+	if (++StepIndex < Steps.Num())
+	{
+		BeginStep();
+		return false;
+	}
+
+	bRunning = false;
+	Scalability::SetQualityLevels(OriginalLevels);
+	Results.Timestamp = FDateTime::UtcNow();
+
+	UE_LOG(LogNohamScalabilityProfiler, Log, TEXT("Scalability profiling finished, baseline %.2f ms GPU"), Results.BaselineGPUTimeMs);
+	return true;
+}
+
+void FNohamScalabilityProfiler::FinishStep()
+{
+	// Median, a single hitch must not decide a group's cost
+	Samples.Sort();
+	const float GPUTimeMs = Samples[Samples.Num() / 2];
+
+	const FStep& Step = Steps[StepIndex];
+	if (Step.GroupIndex == INDEX_NONE)
+	{
+		Results.BaselineGPUTimeMs = GPUTimeMs;
+		for (FNohamScalabilityGroupCost& Cost : Results.Groups)
+		{
+			if (Cost.GPUTimeMs.IsValidIndex(Cost.BaselineLevel))
+			{
+				Cost.GPUTimeMs[Cost.BaselineLevel] = GPUTimeMs;
+			}
+		}
+		return;
+	}
+
+	Results.Groups[Step.GroupIndex].GPUTimeMs[Step.Level] = GPUTimeMs;
+	UE_LOG(LogNohamScalabilityProfiler, Verbose, TEXT("%s level %d: %.2f ms GPU"),
+		*StaticEnum<ENohamScalabilityGroup>()->GetNameStringByValue(Step.GroupIndex), Step.Level, GPUTimeMs);
+}
@@ -1,23 +1,549 @@
 // Copyright Noham Studios. All Rights Reserved.
 
 #include "Subsystems/Settings/NohamSettingsSubsystem.h"
+#include "Subsystems/Settings/NohamQualityGovernor.h"
+#include "Subsystems/Settings/NohamScalabilityProfiler.h"
+#include "Subsystems/Settings/NohamFrameRatePolicy.h"
+#include "Subsystems/Settings/NohamDisplayCapabilityCache.h"
+#include "Framework/Application/SlateApplication.h"
 #include "GameFramework/GameUserSettings.h"
 #include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Crc.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "RHI.h"
+#include "UObject/UnrealType.h"
 #include "JsonObjectConverter.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
+#include "Modules/ModuleManager.h"
+#include "NEON.h"
+#include "NEONBroadcast.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#endif
 
 DEFINE_LOG_CATEGORY_STATIC(LogNohamSettings, Log, All);
 
+namespace NohamSettings
+{
+	// Write to <path>.tmp next to the target and rename it over, so a crash mid-write never leaves a truncated file.
+	// On Windows the rename replaces the target in one step. Elsewhere IFileManager::Move deletes the target first,
+	// a crash in between leaves only the temp file, which LoadSettings picks up (RecoverTempFile).
+	bool SaveArrayToFileAtomic(const TArray<uint8>& Content, const FString& FilePath)
+	{
+		const FString TempPath = FilePath + TEXT(".tmp");
+		if (!FFileHelper::SaveArrayToFile(Content, *TempPath))
+		{
+			return false;
+		}
+#if PLATFORM_WINDOWS
+		const FString AbsoluteTempPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*TempPath);
+		const FString AbsoluteFilePath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*FilePath);
+		if (::MoveFileExW(*AbsoluteTempPath, *AbsoluteFilePath, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+		{
+			return true;
+		}
+		UE_LOG(LogNohamSettings, Warning, TEXT("Replacing %s failed (error %u), falling back to delete and rename"),
+			*FilePath, ::GetLastError());
+#endif
+		return IFileManager::Get().Move(*FilePath, *TempPath, true, true);
+	}
+
+	// Direct struct <-> FJsonObject conversion. No intermediate strings, each document is written or parsed once.
+	template <typename StructType>
+	TSharedPtr<FJsonObject> StructToJson(const StructType& Struct)
+	{
+		TSharedPtr<FJsonObject> Object = MakeShareable(new FJsonObject());
+		if (!FJsonObjectConverter::UStructToJsonObject(StructType::StaticStruct(), &Struct, Object.ToSharedRef(), 0, 0))
+		{
+			return nullptr;
+		}
+		return Object;
+	}
+
+	template <typename StructType>
+	bool JsonToStruct(const TSharedPtr<FJsonObject>& Object, StructType& OutStruct)
+	{
+		return Object.IsValid() && FJsonObjectConverter::JsonObjectToUStruct(Object.ToSharedRef(), &OutStruct, 0, 0);
+	}
+
+	// Combined document of all categories, shared by save, backup and export
+	TSharedRef<FJsonObject> SettingsToJson(const FNohamGraphicsSettings& Graphics, const FNohamAudioSettings& Audio,
+		const FNohamInputSettings& Input)
+	{
+		TSharedRef<FJsonObject> SettingsObject = MakeShareable(new FJsonObject());
+		if (TSharedPtr<FJsonObject> GraphicsObj = StructToJson(Graphics))
+		{
+			SettingsObject->SetObjectField(TEXT("Graphics"), GraphicsObj);
+		}
+		if (TSharedPtr<FJsonObject> AudioObj = StructToJson(Audio))
+		{
+			SettingsObject->SetObjectField(TEXT("Audio"), AudioObj);
+		}
+		if (TSharedPtr<FJsonObject> InputObj = StructToJson(Input))
+		{
+			SettingsObject->SetObjectField(TEXT("Input"), InputObj);
+		}
+		return SettingsObject;
+	}
+
+	bool SerializeSettings(const FNohamGraphicsSettings& Graphics, const FNohamAudioSettings& Audio,
+		const FNohamInputSettings& Input, FString& OutString)
+	{
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutString);
+		return FJsonSerializer::Serialize(SettingsToJson(Graphics, Audio, Input), Writer);
+	}
+
+	TSharedPtr<FJsonObject> ParseSettings(const FString& JsonString)
+	{
+		TSharedPtr<FJsonObject> SettingsObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+		if (!FJsonSerializer::Deserialize(Reader, SettingsObject) || !SettingsObject.IsValid())
+		{
+			return nullptr;
+		}
+		return SettingsObject;
+	}
+
+	// Null when the category is missing
+	TSharedPtr<FJsonObject> GetCategory(const TSharedPtr<FJsonObject>& SettingsObject, const TCHAR* Category)
+	{
+		const TSharedPtr<FJsonObject>* CategoryObject = nullptr;
+		if (!SettingsObject.IsValid() || !SettingsObject->TryGetObjectField(Category, CategoryObject))
+		{
+			return nullptr;
+		}
+		return *CategoryObject;
+	}
+
+	EWindowMode::Type ToEngineWindowMode(int32 WindowMode)
+	{
+		switch (WindowMode)
+		{
+		case 1: return EWindowMode::Windowed;
+		case 2: return EWindowMode::WindowedFullscreen;
+		default: return EWindowMode::Fullscreen;
+		}
+	}
+
+	// NEON topics carrying the changed fields of a category. The settings page subscribes with NEON.subscribe.
+	const FName GraphicsTopic(TEXT("Settings.Graphics"));
+	const FName AudioTopic(TEXT("Settings.Audio"));
+	const FName InputTopic(TEXT("Settings.Input"));
+	const FName DisplayTopic(TEXT("Settings.Display"));
+
+	template <typename StructType>
+	bool IsSameSettings(const StructType& A, const StructType& B)
+	{
+		return StructType::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+	}
+
+	// Only the fields that differ, keyed like the full struct export so pages can merge them into what they have
+	template <typename StructType>
+	void PublishSettingsDelta(FName Topic, const StructType& OldSettings, const StructType& NewSettings)
+	{
+		if (!FModuleManager::Get().IsModuleLoaded(TEXT("NEON")))
+		{
+			return;
+		}
+		FNEONBroadcast& Broadcast = FModuleManager::GetModuleChecked<FNEONModule>(TEXT("NEON")).GetBroadcast();
+		if (Broadcast.GetSubscriberCount(Topic) == 0)
+		{
+			return;
+		}
+
+		TSharedRef<FJsonObject> Delta = MakeShareable(new FJsonObject());
+		for (TFieldIterator<FProperty> It(StructType::StaticStruct()); It; ++It)
+		{
+			const void* OldValue = It->ContainerPtrToValuePtr<void>(&OldSettings);
+			const void* NewValue = It->ContainerPtrToValuePtr<void>(&NewSettings);
+			if (It->Identical(OldValue, NewValue))
+			{
+				continue;
+			}
+			if (TSharedPtr<FJsonValue> Value = FJsonObjectConverter::UPropertyToJsonValue(*It, NewValue))
+			{
+				Delta->SetField(FJsonObjectConverter::StandardizeCase(It->GetName()), Value);
+			}
+		}
+		Broadcast.Publish(Topic, Delta);
+	}
+
+	// Settings field and GameUserSettings setter per ENohamScalabilityGroup
+	struct FScalabilityGroupBinding
+	{
+		int32 FNohamGraphicsSettings::* Field;
+		void (UGameUserSettings::* Setter)(int32);
+	};
+
+	const FScalabilityGroupBinding ScalabilityGroupBindings[] =
+	{
+		{ &FNohamGraphicsSettings::ShadowQuality, &UGameUserSettings::SetShadowQuality },
+		{ &FNohamGraphicsSettings::TextureQuality, &UGameUserSettings::SetTextureQuality },
+		{ &FNohamGraphicsSettings::EffectsQuality, &UGameUserSettings::SetVisualEffectQuality },
+		{ &FNohamGraphicsSettings::PostProcessQuality, &UGameUserSettings::SetPostProcessingQuality },
+		{ &FNohamGraphicsSettings::FoliageQuality, &UGameUserSettings::SetFoliageQuality },
+		{ &FNohamGraphicsSettings::ViewDistanceQuality, &UGameUserSettings::SetViewDistanceQuality },
+		{ &FNohamGraphicsSettings::AntiAliasingQuality, &UGameUserSettings::SetAntiAliasingQuality },
+		{ &FNohamGraphicsSettings::GlobalIlluminationQuality, &UGameUserSettings::SetGlobalIlluminationQuality },
+		{ &FNohamGraphicsSettings::ReflectionQuality, &UGameUserSettings::SetReflectionQuality },
+	};
+	static_assert(UE_ARRAY_COUNT(ScalabilityGroupBindings) == (int32)ENohamScalabilityGroup::MAX, "One binding per scalability group");
+
+	bool HaveSameGroupLevels(const FNohamGraphicsSettings& A, const FNohamGraphicsSettings& B)
+	{
+		for (const FScalabilityGroupBinding& Binding : ScalabilityGroupBindings)
+		{
+			if (A.*Binding.Field != B.*Binding.Field)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void ClearGroupLevels(FNohamGraphicsSettings& Settings)
+	{
+		for (const FScalabilityGroupBinding& Binding : ScalabilityGroupBindings)
+		{
+			Settings.*Binding.Field = -1;
+		}
+	}
+
+	// Preset, group overrides and resolution scale into GameUserSettings, not applied yet
+	void SetUserScalability(UGameUserSettings* UserSettings, const FNohamGraphicsSettings& Settings)
+	{
+		UserSettings->SetOverallScalabilityLevel(Settings.QualityPreset);
+		for (const FScalabilityGroupBinding& Binding : ScalabilityGroupBindings)
+		{
+			if (Settings.*Binding.Field >= 0)
+			{
+				(UserSettings->*Binding.Setter)(Settings.*Binding.Field);
+			}
+		}
+		// After the preset, which resets the resolution quality
+		UserSettings->SetResolutionScaleValueEx(Settings.ResolutionScale);
+	}
+
+	// Binary store layout:
+	//   uint32 Magic, int32 Version, FPackageFileVersion UEVer, int32 LicenseeUEVer,
+	//   FCustomVersionContainer CustomVersions, uint32 SchemaHash, int32 NumCategories,
+	//   then per category: FString Name, TArray<uint8> Payload
+	// Payloads are tagged property streams delta'd against the struct defaults. Fields that are
+	// missing on load keep their defaults and unknown fields are skipped, so adding, removing or
+	// reordering struct members needs no version bump. Version only covers this container layout.
+	// The engine and custom versions the payloads were written with are applied to the readers, so
+	// property types whose serialization changes in a later engine still load.
+	// Version 1 had no archive versions, its payloads are read with the current ones.
+	constexpr uint32 BinaryMagic = 0x4253484E; // "NHSB"
+	constexpr int32 BinaryVersion = 2;
+
+	struct FBinaryArchiveVersions
+	{
+		FPackageFileVersion UEVer = GPackageFileUEVersion;
+		int32 LicenseeUEVer = GPackageFileLicenseeUEVersion;
+		FCustomVersionContainer CustomVersions = FCurrentCustomVersions::GetAll();
+
+		void Serialize(FArchive& Ar)
+		{
+			Ar << UEVer << LicenseeUEVer;
+			CustomVersions.Serialize(Ar);
+		}
+
+		void ApplyTo(FArchive& Ar) const
+		{
+			Ar.SetUEVer(UEVer);
+			Ar.SetLicenseeUEVer(LicenseeUEVer);
+			Ar.SetCustomVersions(CustomVersions);
+		}
+	};
+
+	template <typename StructType>
+	uint32 HashStructLayout(uint32 Hash)
+	{
+		for (TFieldIterator<FProperty> It(StructType::StaticStruct()); It; ++It)
+		{
+			Hash = FCrc::StrCrc32(*It->GetName(), Hash);
+			Hash = FCrc::StrCrc32(*It->GetCPPType(), Hash);
+		}
+		return Hash;
+	}
+
+	// Changes whenever a settings struct gains, loses or retypes a field
+	uint32 GetSchemaHash()
+	{
+		static const uint32 SchemaHash = HashStructLayout<FNohamHardwareBenchmark>(HashStructLayout<FNohamInputSettings>(
+			HashStructLayout<FNohamAudioSettings>(HashStructLayout<FNohamGraphicsSettings>(0))));
+		return SchemaHash;
+	}
+
+	template <typename StructType>
+	void WriteCategory(FArchive& Ar, const TCHAR* Category, const StructType& Struct)
+	{
+		StructType Defaults;
+		TArray<uint8> Payload;
+		FMemoryWriter PayloadWriter(Payload, true);
+		StructType::StaticStruct()->SerializeTaggedProperties(PayloadWriter, (uint8*)&Struct,
+			StructType::StaticStruct(), (uint8*)&Defaults);
+
+		FString Name(Category);
+		Ar << Name;
+		Ar << Payload;
+	}
+
+	template <typename StructType>
+	bool ReadCategory(const TArray<uint8>& Payload, const FBinaryArchiveVersions& Versions, StructType& OutStruct)
+	{
+		StructType Struct;
+		FMemoryReader PayloadReader(Payload, true);
+		Versions.ApplyTo(PayloadReader);
+		StructType::StaticStruct()->SerializeTaggedProperties(PayloadReader, (uint8*)&Struct,
+			StructType::StaticStruct(), nullptr);
+		if (PayloadReader.IsError())
+		{
+			return false;
+		}
+		OutStruct = Struct;
+		return true;
+	}
+
+	void SerializeSettingsBinary(const FNohamGraphicsSettings& Graphics, const FNohamAudioSettings& Audio,
+		const FNohamInputSettings& Input, const FNohamHardwareBenchmark& Benchmark, TArray<uint8>& OutData)
+	{
+		FMemoryWriter Writer(OutData, true);
+		uint32 Magic = BinaryMagic;
+		int32 Version = BinaryVersion;
+		// The payload writers start from the same defaults as this one
+		FBinaryArchiveVersions Versions;
+		Versions.UEVer = Writer.UEVer();
+		Versions.LicenseeUEVer = Writer.LicenseeUEVer();
+		uint32 SchemaHash = GetSchemaHash();
+		int32 NumCategories = 4;
+		Writer << Magic << Version;
+		Versions.Serialize(Writer);
+		Writer << SchemaHash << NumCategories;
+
+		WriteCategory(Writer, TEXT("Graphics"), Graphics);
+		WriteCategory(Writer, TEXT("Audio"), Audio);
+		WriteCategory(Writer, TEXT("Input"), Input);
+		WriteCategory(Writer, TEXT("Benchmark"), Benchmark);
+	}
+
+	// Synth benchmark performance index -> quality preset. Below the first threshold is Low.
+	constexpr float PresetScoreThresholds[] = { 60.0f, 110.0f, 180.0f };
+	// Per preset, Low to Epic. The lower presets also cap the frame rate so handhelds hold a steady target.
+	constexpr float PresetResolutionScale[] = { 67.0f, 83.0f, 100.0f, 100.0f };
+	constexpr int32 PresetFrameRateLimit[] = { 30, 60, 0, 0 };
+
+	int32 ScoreToPreset(float Score)
+	{
+		int32 Preset = 0;
+		while (Preset < UE_ARRAY_COUNT(PresetScoreThresholds) && Score >= PresetScoreThresholds[Preset])
+		{
+			++Preset;
+		}
+		return Preset;
+	}
+
+	// Stable across driver updates, changes with the CPU, GPU or memory size
+	FString GetHardwareFingerprint()
+	{
+		const FString Hardware = FString::Printf(TEXT("%s|%s|%u|%d"),
+			*FPlatformMisc::GetCPUBrand().TrimStartAndEnd(), *GRHIAdapterName.TrimStartAndEnd(),
+			FPlatformMemory::GetConstants().TotalPhysicalGB, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		return FString::Printf(TEXT("%08x"), FCrc::StrCrc32(*Hardware));
+	}
+
+	// Splits the blob into per-category payloads, false if it is not a settings blob this build can read
+	bool ParseSettingsBinary(const TArray<uint8>& Data, TMap<FString, TArray<uint8>>& OutCategories,
+		FBinaryArchiveVersions& OutVersions, bool& bOutSchemaChanged)
+	{
+		FMemoryReader Reader(Data, true);
+		uint32 Magic = 0;
+		int32 Version = 0;
+		Reader << Magic << Version;
+		if (Reader.IsError() || Magic != BinaryMagic || Version < 1 || Version > BinaryVersion)
+		{
+			return false;
+		}
+
+		OutVersions = FBinaryArchiveVersions();
+		if (Version >= 2)
+		{
+			OutVersions.Serialize(Reader);
+		}
+
+		uint32 SchemaHash = 0;
+		int32 NumCategories = 0;
+		Reader << SchemaHash << NumCategories;
+		if (Reader.IsError() || NumCategories < 0)
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < NumCategories; ++i)
+		{
+			FString Name;
+			TArray<uint8> Payload;
+			Reader << Name;
+			Reader << Payload;
+			if (Reader.IsError())
+			{
+				return false;
+			}
+			OutCategories.Add(MoveTemp(Name), MoveTemp(Payload));
+		}
+
+		// An older container is rewritten like a changed schema
+		bOutSchemaChanged = SchemaHash != GetSchemaHash() || Version < BinaryVersion;
+		return true;
+	}
+
+	// The settings file is missing but a complete temp file from SaveArrayToFileAtomic is there: finish its rename.
+	// A temp file that doesn't parse was cut off mid-write and is ignored.
+	bool RecoverTempFile(const FString& FilePath, TArray<uint8>& OutData)
+	{
+		const FString TempPath = FilePath + TEXT(".tmp");
+		TMap<FString, TArray<uint8>> Categories;
+		FBinaryArchiveVersions Versions;
+		bool bSchemaChanged = false;
+		if (!FFileHelper::LoadFileToArray(OutData, *TempPath, FILEREAD_Silent)
+			|| !ParseSettingsBinary(OutData, Categories, Versions, bSchemaChanged))
+		{
+			OutData.Reset();
+			return false;
+		}
+
+		UE_LOG(LogNohamSettings, Warning, TEXT("Recovered settings from an interrupted save: %s"), *TempPath);
+		IFileManager::Get().Move(*FilePath, *TempPath, true, true);
+		return true;
+	}
+
+#if !UE_BUILD_SHIPPING
+	// The previous codec: struct -> string -> object -> string per category, and the reverse on load
+	template <typename StructType>
+	TSharedPtr<FJsonObject> StructToJsonViaString(const StructType& Struct)
+	{
+		FString Json;
+		TSharedPtr<FJsonObject> Object;
+		if (FJsonObjectConverter::UStructToJsonObjectString(Struct, Json))
+		{
+			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+			FJsonSerializer::Deserialize(Reader, Object);
+		}
+		return Object;
+	}
+
+	template <typename StructType>
+	bool JsonToStructViaString(const TSharedPtr<FJsonObject>& Object, StructType& OutStruct)
+	{
+		FString Json;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		return Object.IsValid() && FJsonSerializer::Serialize(Object.ToSharedRef(), Writer)
+			&& FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutStruct, 0, 0);
+	}
+
+	// Noham.Settings.BenchmarkCodec [Iterations]
+	// Save + load round trips of the default settings with the old and the new codec
+	FAutoConsoleCommand BenchmarkCodecCommand(
+		TEXT("Noham.Settings.BenchmarkCodec"),
+		TEXT("Compare the settings JSON codec against the old string round trip. Args: [Iterations=1000]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+			FNohamGraphicsSettings Graphics;
+			FNohamAudioSettings Audio;
+			FNohamInputSettings Input;
+
+			FString Legacy;
+			double Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				TSharedRef<FJsonObject> SettingsObject = MakeShareable(new FJsonObject());
+				SettingsObject->SetObjectField(TEXT("Graphics"), StructToJsonViaString(Graphics));
+				SettingsObject->SetObjectField(TEXT("Audio"), StructToJsonViaString(Audio));
+				SettingsObject->SetObjectField(TEXT("Input"), StructToJsonViaString(Input));
+				Legacy.Reset();
+				TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Legacy);
+				FJsonSerializer::Serialize(SettingsObject, Writer);
+
+				TSharedPtr<FJsonObject> Parsed = ParseSettings(Legacy);
+				JsonToStructViaString(GetCategory(Parsed, TEXT("Graphics")), Graphics);
+				JsonToStructViaString(GetCategory(Parsed, TEXT("Audio")), Audio);
+				JsonToStructViaString(GetCategory(Parsed, TEXT("Input")), Input);
+			}
+			const double LegacyMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+			FString Direct;
+			Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				Direct.Reset();
+				SerializeSettings(Graphics, Audio, Input, Direct);
+
+				TSharedPtr<FJsonObject> Parsed = ParseSettings(Direct);
+				JsonToStruct(GetCategory(Parsed, TEXT("Graphics")), Graphics);
+				JsonToStruct(GetCategory(Parsed, TEXT("Audio")), Audio);
+				JsonToStruct(GetCategory(Parsed, TEXT("Input")), Input);
+			}
+			const double DirectMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+			TArray<uint8> Binary;
+			Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				Binary.Reset();
+				SerializeSettingsBinary(Graphics, Audio, Input, FNohamHardwareBenchmark(), Binary);
+
+				TMap<FString, TArray<uint8>> Categories;
+				FBinaryArchiveVersions Versions;
+				bool bSchemaChanged = false;
+				ParseSettingsBinary(Binary, Categories, Versions, bSchemaChanged);
+				ReadCategory(Categories.FindRef(TEXT("Graphics")), Versions, Graphics);
+				ReadCategory(Categories.FindRef(TEXT("Audio")), Versions, Audio);
+				ReadCategory(Categories.FindRef(TEXT("Input")), Versions, Input);
+			}
+			const double BinaryMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+			UE_LOG(LogNohamSettings, Display, TEXT("Settings codec, %d round trips: string round trip %.4f ms / %d chars, direct %.4f ms / %d chars (%.1fx), binary %.4f ms / %d bytes (%.1fx)"),
+				Iterations, LegacyMs, Legacy.Len(), DirectMs, Direct.Len(), DirectMs > 0.0 ? LegacyMs / DirectMs : 0.0,
+				BinaryMs, Binary.Num(), BinaryMs > 0.0 ? LegacyMs / BinaryMs : 0.0);
+		}));
+#endif
+}
+
 void UNohamSettingsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
 	bIsInitialized = true;
+	QualityGovernor = MakeShared<FNohamQualityGovernor>();
+	ScalabilityProfiler = MakeShared<FNohamScalabilityProfiler>();
+	FrameRatePolicy = MakeShared<FNohamFrameRatePolicy>();
+
+	// Display capabilities are queried off the game thread while the rest starts up
+	DisplayCapabilityCache = MakeShared<FNohamDisplayCapabilityCache>();
+	RefreshDisplayCapabilities();
+
+	// Pages subscribe to Settings.Display after the startup build was published, they get it on subscribe
+	if (FModuleManager::Get().IsModuleLoaded(TEXT("NEON")))
+	{
+		TopicSubscribedHandle = FModuleManager::GetModuleChecked<FNEONModule>(TEXT("NEON")).GetBroadcast().OnSubscribed
+			.AddUObject(this, &UNohamSettingsSubsystem::HandleTopicSubscribed);
+	}
 
 	// Refresh audio devices on startup
 	RefreshAudioDevices();
@@ -25,7 +551,47 @@ void UNohamSettingsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	// Load saved settings or use defaults
 	if (!LoadSettings())
 	{
+		// A partly read file counts as no file, the benchmark may pick the preset
 		LoadDefaultSettings();
+		bLoadedGraphicsSettings = false;
+	}
+	BroadcastSettingsChanges();
+
+	// Frame rate caps follow focus and full-screen menus
+	if (FSlateApplication::IsInitialized())
+	{
+		FrameRatePolicy->SetFocused(FSlateApplication::Get().IsActive());
+		ActivationStateChangedHandle = FSlateApplication::Get().OnApplicationActivationStateChanged()
+			.AddUObject(this, &UNohamSettingsSubsystem::HandleApplicationActivationChanged);
+
+		// Monitor hot-plug, resolution or arrangement changes
+		if (TSharedPtr<GenericApplication> PlatformApplication = FSlateApplication::Get().GetPlatformApplication())
+		{
+			DisplayMetricsChangedHandle = PlatformApplication->OnDisplayMetricsChanged()
+				.AddUObject(this, &UNohamSettingsSubsystem::HandleDisplayMetricsChanged);
+		}
+	}
+	EnterBackgroundHandle = FCoreDelegates::ApplicationWillEnterBackgroundDelegate
+		.AddUObject(this, &UNohamSettingsSubsystem::HandleApplicationActivationChanged, false);
+	EnterForegroundHandle = FCoreDelegates::ApplicationHasEnteredForegroundDelegate
+		.AddUObject(this, &UNohamSettingsSubsystem::HandleApplicationActivationChanged, true);
+
+	UIManager = Collection.InitializeDependency<UNohamUIManagerSubsystem>();
+	if (UIManager.IsValid())
+	{
+		FrameRatePolicy->SetMenuOpen(UIManager->GetCurrentInputMode() == ENohamUIInputMode::UIOnly);
+		UIManager->OnUIInputModeChanged.AddDynamic(this, &UNohamSettingsSubsystem::HandleUIInputModeChanged);
+	}
+	UpdateFrameRatePolicy(true);
+
+	// Benchmark once per machine, on the next tick so the splash screen is up first
+	if (FApp::CanEverRender()
+		&& (!HardwareBenchmark.IsValid() || HardwareBenchmark.HardwareFingerprint != NohamSettings::GetHardwareFingerprint()))
+	{
+		if (UGameInstance* GameInstance = GetGameInstance())
+		{
+			GameInstance->GetTimerManager().SetTimerForNextTick(this, &UNohamSettingsSubsystem::RunFirstLaunchBenchmark);
+		}
 	}
 
 	UE_LOG(LogNohamSettings, Log, TEXT("NohamSettingsSubsystem initialized successfully"));
@@ -33,8 +599,43 @@ void UNohamSettingsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UNohamSettingsSubsystem::Deinitialize()
 {
-	// Save settings before shutdown
-	SaveSettings();
+	// Write whatever the debounce is still holding and wait for it
+	FlushSettings();
+	WaitForPendingSave();
+
+	CancelScalabilityProfiling();
+	ScalabilityProfiler.Reset();
+
+	FTSTicker::GetCoreTicker().RemoveTicker(QualityGovernorTicker);
+	QualityGovernorTicker.Reset();
+	QualityGovernor.Reset();
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().OnApplicationActivationStateChanged().Remove(ActivationStateChangedHandle);
+		if (TSharedPtr<GenericApplication> PlatformApplication = FSlateApplication::Get().GetPlatformApplication())
+		{
+			PlatformApplication->OnDisplayMetricsChanged().Remove(DisplayMetricsChangedHandle);
+		}
+	}
+	FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(EnterBackgroundHandle);
+	FCoreDelegates::ApplicationHasEnteredForegroundDelegate.Remove(EnterForegroundHandle);
+	if (UIManager.IsValid())
+	{
+		UIManager->OnUIInputModeChanged.RemoveDynamic(this, &UNohamSettingsSubsystem::HandleUIInputModeChanged);
+	}
+	UIManager.Reset();
+	FrameRatePolicy.Reset();
+
+	if (TopicSubscribedHandle.IsValid() && FModuleManager::Get().IsModuleLoaded(TEXT("NEON")))
+	{
+		FModuleManager::GetModuleChecked<FNEONModule>(TEXT("NEON")).GetBroadcast().OnSubscribed.Remove(TopicSubscribedHandle);
+	}
+	TopicSubscribedHandle.Reset();
+
+	FTSTicker::GetCoreTicker().RemoveTicker(DisplayCapabilityTicker);
+	DisplayCapabilityTicker.Reset();
+	DisplayCapabilityCache.Reset();
 
 	bIsInitialized = false;
 
@@ -47,28 +648,119 @@ void UNohamSettingsSubsystem::Deinitialize()
 
 TArray<FIntPoint> UNohamSettingsSubsystem::GetSupportedResolutions()
 {
+	if (!DisplayCapabilityCache)
+	{
+		return TArray<FIntPoint>();
+	}
+
+	const FNohamDisplayCapabilities& Capabilities = DisplayCapabilityCache->Get();
+	if (Capabilities.Resolutions.Num() > 0)
+	{
+		return Capabilities.Resolutions;
+	}
+
+	// No fullscreen modes reported (windowed only platforms), offer the monitors' own resolutions
 	TArray<FIntPoint> Resolutions;
+	for (const FNohamMonitorInfo& Monitor : Capabilities.Monitors)
+	{
+		Resolutions.AddUnique(Monitor.NativeResolution);
+	}
+	return Resolutions;
+}
 
-	// Get supported fullscreen resolutions from engine
-	FScreenResolutionArray ResolutionArray;
-	if (RHIGetAvailableResolutions(ResolutionArray, true))
+TArray<int32> UNohamSettingsSubsystem::GetSupportedRefreshRates(FIntPoint Resolution)
+{
+	TArray<int32> RefreshRates;
+	if (!DisplayCapabilityCache)
+	{
+		return RefreshRates;
+	}
+
+	// Modes are sorted by refresh rate within a resolution
+	for (const FNohamDisplayMode& Mode : DisplayCapabilityCache->Get().DisplayModes)
 	{
-		for (const FScreenResolutionRHI& Resolution : ResolutionArray)
+		if (Mode.Resolution == Resolution && Mode.RefreshRate > 0)
 		{
-			Resolutions.Add(FIntPoint(Resolution.Width, Resolution.Height));
+			RefreshRates.Add(Mode.RefreshRate);
 		}
 	}
+	return RefreshRates;
+}
+
+FNohamDisplayCapabilities UNohamSettingsSubsystem::GetDisplayCapabilities()
+{
+	return DisplayCapabilityCache ? DisplayCapabilityCache->Get() : FNohamDisplayCapabilities();
+}
+
+void UNohamSettingsSubsystem::RefreshDisplayCapabilities()
+{
+	if (!DisplayCapabilityCache)
+	{
+		return;
+	}
 
-	// If we couldn't get resolutions, provide common defaults
-	if (Resolutions.Num() == 0)
+	DisplayCapabilityCache->Rebuild();
+	if (!DisplayCapabilityTicker.IsValid())
 	{
-		Resolutions.Add(FIntPoint(1920, 1080));
-		Resolutions.Add(FIntPoint(2560, 1440));
-		Resolutions.Add(FIntPoint(3840, 2160));
-		Resolutions.Add(FIntPoint(1280, 720));
+		DisplayCapabilityTicker = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UNohamSettingsSubsystem::TickDisplayCapabilities));
 	}
+}
 
-	return Resolutions;
+void UNohamSettingsSubsystem::PublishDisplayCapabilities()
+{
+	if (!DisplayCapabilityCache || !FModuleManager::Get().IsModuleLoaded(TEXT("NEON")))
+	{
+		return;
+	}
+	FNEONBroadcast& Broadcast = FModuleManager::GetModuleChecked<FNEONModule>(TEXT("NEON")).GetBroadcast();
+	if (Broadcast.GetSubscriberCount(NohamSettings::DisplayTopic) == 0)
+	{
+		return;
+	}
+
+	// The whole set in one message, pages rebuild their lists from it
+	TSharedRef<FJsonObject> Payload = MakeShareable(new FJsonObject());
+	if (FJsonObjectConverter::UStructToJsonObject(FNohamDisplayCapabilities::StaticStruct(), &DisplayCapabilityCache->Get(), Payload))
+	{
+		Broadcast.Publish(NohamSettings::DisplayTopic, Payload);
+	}
+}
+
+void UNohamSettingsSubsystem::HandleTopicSubscribed(FName Topic, UNEONWidget* Widget)
+{
+	// Still building: TickDisplayCapabilities publishes once it is done
+	if (Topic == NohamSettings::DisplayTopic && DisplayCapabilityCache && !DisplayCapabilityCache->IsBuilding()
+		&& DisplayCapabilityCache->Get().IsValid())
+	{
+		PublishDisplayCapabilities();
+	}
+}
+
+void UNohamSettingsSubsystem::HandleDisplayMetricsChanged(const FDisplayMetrics& DisplayMetrics)
+{
+	UE_LOG(LogNohamSettings, Log, TEXT("Display setup changed, refreshing display capabilities"));
+	RefreshDisplayCapabilities();
+}
+
+bool UNohamSettingsSubsystem::TickDisplayCapabilities(float DeltaTime)
+{
+	DisplayCapabilityCache->Poll();
+	if (DisplayCapabilityCache->IsBuilding())
+	{
+		return true;
+	}
+	DisplayCapabilityTicker.Reset();
+
+	// A getter may have taken the result already, the event still goes out once per build
+	const FNohamDisplayCapabilities& Capabilities = DisplayCapabilityCache->Get();
+	if (Capabilities.Revision != BroadcastDisplayRevision)
+	{
+		BroadcastDisplayRevision = Capabilities.Revision;
+		PublishDisplayCapabilities();
+		OnDisplayCapabilitiesChanged.Broadcast(Capabilities);
+	}
+	return false;
 }
 
 bool UNohamSettingsSubsystem::UpdateGraphicsSettings(const FNohamGraphicsSettings& NewSettings)
@@ -79,12 +771,13 @@ bool UNohamSettingsSubsystem::UpdateGraphicsSettings(const FNohamGraphicsSetting
 		return false;
 	}
 
-	GraphicsSettings = NewSettings;
-	ApplyGraphicsSettings();
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings = NewSettings;
+	CommitGraphicsTransaction();
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Graphics settings updated: %dx%d, WindowMode=%d, VSync=%d"),
-		GraphicsSettings.Resolution.X, GraphicsSettings.Resolution.Y,
-		GraphicsSettings.WindowMode, GraphicsSettings.bVSyncEnabled);
+		NewSettings.Resolution.X, NewSettings.Resolution.Y,
+		NewSettings.WindowMode, NewSettings.bVSyncEnabled);
 
 	return true;
 }
@@ -97,15 +790,9 @@ bool UNohamSettingsSubsystem::SetResolution(FIntPoint NewResolution)
 		return false;
 	}
 
-	GraphicsSettings.Resolution = NewResolution;
-
-	UGameUserSettings* UserSettings = GEngine->GetGameUserSettings();
-	if (UserSettings)
-	{
-		UserSettings->SetScreenResolution(NewResolution);
-		UserSettings->ApplyResolutionSettings(false);
-		UserSettings->SaveSettings();
-	}
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.Resolution = NewResolution;
+	CommitGraphicsTransaction();
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Resolution changed to: %dx%d"), NewResolution.X, NewResolution.Y);
 	return true;
@@ -119,86 +806,416 @@ bool UNohamSettingsSubsystem::SetWindowMode(int32 WindowMode)
 		return false;
 	}
 
-	GraphicsSettings.WindowMode = WindowMode;
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.WindowMode = WindowMode;
+	CommitGraphicsTransaction();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("Window mode changed to: %d"), WindowMode);
+	return true;
+}
+
+bool UNohamSettingsSubsystem::SetVSync(bool bEnabled)
+{
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.bVSyncEnabled = bEnabled;
+	CommitGraphicsTransaction();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("VSync %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+	return true;
+}
+
+bool UNohamSettingsSubsystem::SetFrameRateLimit(int32 Limit)
+{
+	if (Limit < 0 || (Limit > 0 && Limit < 30))
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid frame rate limit: %d"), Limit);
+		return false;
+	}
+
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.FrameRateLimit = Limit;
+	CommitGraphicsTransaction();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("Frame rate limit set to: %d"), Limit);
+	return true;
+}
+
+bool UNohamSettingsSubsystem::SetFrameRatePolicy(int32 MenuLimit, int32 BackgroundLimit)
+{
+	if (MenuLimit < 0 || (MenuLimit > 0 && MenuLimit < 10) || BackgroundLimit < 0 || (BackgroundLimit > 0 && BackgroundLimit < 5))
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid frame rate policy: menu %d, background %d"), MenuLimit, BackgroundLimit);
+		return false;
+	}
+
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.MenuFrameRateLimit = MenuLimit;
+	PendingGraphicsSettings.BackgroundFrameRateLimit = BackgroundLimit;
+	CommitGraphicsTransaction();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("Frame rate policy set to: menu %d, background %d"), MenuLimit, BackgroundLimit);
+	return true;
+}
+
+ENohamFrameRateState UNohamSettingsSubsystem::GetFrameRateState() const
+{
+	return FrameRatePolicy ? FrameRatePolicy->GetState() : ENohamFrameRateState::Gameplay;
+}
+
+int32 UNohamSettingsSubsystem::GetActiveFrameRateLimit() const
+{
+	return FrameRatePolicy ? FrameRatePolicy->GetActiveLimit() : GraphicsSettings.FrameRateLimit;
+}
+
+void UNohamSettingsSubsystem::UpdateFrameRatePolicy(bool bForce)
+{
+	if (!FrameRatePolicy)
+	{
+		return;
+	}
+
+	FNohamFrameRatePolicy::FCaps Caps;
+	Caps.Gameplay = GraphicsSettings.FrameRateLimit;
+	Caps.Menu = GraphicsSettings.MenuFrameRateLimit;
+	Caps.Background = GraphicsSettings.BackgroundFrameRateLimit;
+	FrameRatePolicy->SetCaps(Caps);
+
+	if (bForce)
+	{
+		FrameRatePolicy->Apply(true);
+	}
+}
+
+void UNohamSettingsSubsystem::HandleApplicationActivationChanged(bool bIsActive)
+{
+	if (FrameRatePolicy)
+	{
+		FrameRatePolicy->SetFocused(bIsActive);
+	}
+}
+
+void UNohamSettingsSubsystem::HandleUIInputModeChanged(ENohamUIInputMode NewInputMode)
+{
+	if (FrameRatePolicy)
+	{
+		FrameRatePolicy->SetMenuOpen(NewInputMode == ENohamUIInputMode::UIOnly);
+	}
+}
+
+bool UNohamSettingsSubsystem::SetQualityPreset(int32 Preset)
+{
+	if (Preset < 0 || Preset > 3)
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid quality preset: %d"), Preset);
+		return false;
+	}
+
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.QualityPreset = Preset;
+	NohamSettings::ClearGroupLevels(PendingGraphicsSettings);
+	CommitGraphicsTransaction();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("Quality preset set to: %d"), Preset);
+	return true;
+}
+
+bool UNohamSettingsSubsystem::SetResolutionScale(float Scale)
+{
+	if (Scale < 25.0f || Scale > 100.0f)
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid resolution scale: %.1f"), Scale);
+		return false;
+	}
+
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.ResolutionScale = Scale;
+	CommitGraphicsTransaction();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("Resolution scale set to: %.1f"), Scale);
+	return true;
+}
+
+bool UNohamSettingsSubsystem::SetScalabilityGroupLevel(ENohamScalabilityGroup Group, int32 Level)
+{
+	if (Group >= ENohamScalabilityGroup::MAX || Level < -1 || Level > 3)
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid scalability group level: %d"), Level);
+		return false;
+	}
+
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.*NohamSettings::ScalabilityGroupBindings[(int32)Group].Field = Level;
+	CommitGraphicsTransaction();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("%s quality set to: %d"), *StaticEnum<ENohamScalabilityGroup>()->GetNameStringByValue((int64)Group), Level);
+	return true;
+}
+
+int32 UNohamSettingsSubsystem::GetEffectiveGroupLevel(const FNohamGraphicsSettings& Settings, ENohamScalabilityGroup Group)
+{
+	if (Group >= ENohamScalabilityGroup::MAX)
+	{
+		return Settings.QualityPreset;
+	}
+	const int32 Level = Settings.*NohamSettings::ScalabilityGroupBindings[(int32)Group].Field;
+	return Level >= 0 ? Level : Settings.QualityPreset;
+}
+
+bool UNohamSettingsSubsystem::StartScalabilityProfiling()
+{
+	if (!ScalabilityProfiler || ScalabilityProfiler->IsRunning())
+	{
+		return false;
+	}
+
+	// The governor would fight the levels being measured
+	bGovernorLockedBeforeProfiling = IsAdaptiveQualityLocked();
+	SetAdaptiveQualityLocked(true);
+
+	ScalabilityProfiler->Start();
+	ScalabilityProfilerTicker = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UNohamSettingsSubsystem::TickScalabilityProfiler));
+	return true;
+}
+
+void UNohamSettingsSubsystem::CancelScalabilityProfiling()
+{
+	if (ScalabilityProfiler && ScalabilityProfiler->IsRunning())
+	{
+		ScalabilityProfiler->Cancel();
+		StopScalabilityProfilerTicker();
+	}
+}
+
+bool UNohamSettingsSubsystem::IsProfilingScalability() const
+{
+	return ScalabilityProfiler && ScalabilityProfiler->IsRunning();
+}
+
+bool UNohamSettingsSubsystem::TickScalabilityProfiler(float DeltaTime)
+{
+	if (!ScalabilityProfiler->Tick(DeltaTime))
+	{
+		return ScalabilityProfiler->IsRunning();
+	}
+
+	ScalabilityCostEstimates = ScalabilityProfiler->GetResults();
+	StopScalabilityProfilerTicker();
+	OnScalabilityProfilingCompleted.Broadcast(ScalabilityCostEstimates);
+	return false;
+}
+
+void UNohamSettingsSubsystem::StopScalabilityProfilerTicker()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(ScalabilityProfilerTicker);
+	ScalabilityProfilerTicker.Reset();
+	SetAdaptiveQualityLocked(bGovernorLockedBeforeProfiling);
+}
+
+float UNohamSettingsSubsystem::EstimateGPUFrameTimeMs(const FNohamGraphicsSettings& Candidate) const
+{
+	if (!ScalabilityCostEstimates.IsValid())
+	{
+		return -1.0f;
+	}
+
+	// Groups are measured one at a time against the same baseline, their differences are assumed to add up
+	float GPUTimeMs = ScalabilityCostEstimates.BaselineGPUTimeMs;
+	for (const FNohamScalabilityGroupCost& Cost : ScalabilityCostEstimates.Groups)
+	{
+		const int32 Level = GetEffectiveGroupLevel(Candidate, Cost.Group);
+		if (Cost.GPUTimeMs.IsValidIndex(Level) && Cost.GPUTimeMs[Level] > 0.0f)
+		{
+			GPUTimeMs += Cost.GPUTimeMs[Level] - ScalabilityCostEstimates.BaselineGPUTimeMs;
+		}
+	}
+
+	// Most of the frame scales with the pixel count
+	const float ScaleRatio = Candidate.ResolutionScale / FMath::Max(ScalabilityCostEstimates.ProfiledResolutionScale, 1.0f);
+	return FMath::Max(GPUTimeMs * ScaleRatio * ScaleRatio, 0.0f);
+}
+
+bool UNohamSettingsSubsystem::SetAdaptiveQuality(bool bEnabled, float TargetFrameTimeMs)
+{
+	if (TargetFrameTimeMs < 4.0f || TargetFrameTimeMs > 50.0f)
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid target frame time: %.2f ms"), TargetFrameTimeMs);
+		return false;
+	}
+
+	BeginGraphicsTransaction();
+	PendingGraphicsSettings.bAdaptiveQuality = bEnabled;
+	PendingGraphicsSettings.TargetFrameTimeMs = TargetFrameTimeMs;
+	CommitGraphicsTransaction();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("Adaptive quality %s, target %.2f ms"), bEnabled ? TEXT("enabled") : TEXT("disabled"), TargetFrameTimeMs);
+	return true;
+}
+
+void UNohamSettingsSubsystem::SetAdaptiveQualityLocked(bool bLocked)
+{
+	if (QualityGovernor)
+	{
+		QualityGovernor->SetLocked(bLocked);
+	}
+}
+
+bool UNohamSettingsSubsystem::IsAdaptiveQualityLocked() const
+{
+	return QualityGovernor && QualityGovernor->IsLocked();
+}
+
+FNohamAdaptiveQualityStats UNohamSettingsSubsystem::GetAdaptiveQualityStats() const
+{
+	return QualityGovernor ? QualityGovernor->GetStats() : FNohamAdaptiveQualityStats();
+}
+
+void UNohamSettingsSubsystem::ResetAdaptiveQualityStats()
+{
+	if (QualityGovernor)
+	{
+		QualityGovernor->ResetStats();
+	}
+}
+
+void UNohamSettingsSubsystem::UpdateQualityGovernor(bool bRestart)
+{
+	if (!QualityGovernor)
+	{
+		return;
+	}
+
+	if (!GraphicsSettings.bAdaptiveQuality)
+	{
+		QualityGovernor->Stop();
+		FTSTicker::GetCoreTicker().RemoveTicker(QualityGovernorTicker);
+		QualityGovernorTicker.Reset();
+		return;
+	}
 
-	UGameUserSettings* UserSettings = GEngine->GetGameUserSettings();
-	if (UserSettings)
+	if (bRestart || !QualityGovernor->IsRunning())
 	{
-		EWindowMode::Type Mode = EWindowMode::Fullscreen;
-		switch (WindowMode)
-		{
-		case 0: Mode = EWindowMode::Fullscreen; break;
-		case 1: Mode = EWindowMode::Windowed; break;
-		case 2: Mode = EWindowMode::WindowedFullscreen; break;
-		}
+		FNohamQualityGovernor::FConfig Config;
+		Config.TargetFrameTimeMs = GraphicsSettings.TargetFrameTimeMs;
+		Config.MinResolutionScale = FMath::Min(GraphicsSettings.MinAdaptiveResolutionScale, GraphicsSettings.ResolutionScale);
+		Config.MaxResolutionScale = GraphicsSettings.ResolutionScale;
+		QualityGovernor->Start(Config);
+	}
 
-		UserSettings->SetFullscreenMode(Mode);
-		UserSettings->ApplyResolutionSettings(false);
-		UserSettings->SaveSettings();
+	if (!QualityGovernorTicker.IsValid())
+	{
+		QualityGovernorTicker = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UNohamSettingsSubsystem::TickQualityGovernor));
 	}
+}
 
-	UE_LOG(LogNohamSettings, Log, TEXT("Window mode changed to: %d"), WindowMode);
+bool UNohamSettingsSubsystem::TickQualityGovernor(float DeltaTime)
+{
+	QualityGovernor->Tick(DeltaTime);
 	return true;
 }
 
-bool UNohamSettingsSubsystem::SetVSync(bool bEnabled)
+FNohamHardwareBenchmark UNohamSettingsSubsystem::RunHardwareBenchmark(bool bApplyRecommended)
 {
-	GraphicsSettings.bVSyncEnabled = bEnabled;
-
 	UGameUserSettings* UserSettings = GEngine->GetGameUserSettings();
-	if (UserSettings)
+	if (!UserSettings)
 	{
-		UserSettings->SetVSyncEnabled(bEnabled);
-		UserSettings->ApplySettings(false);
-		UserSettings->SaveSettings();
+		UE_LOG(LogNohamSettings, Error, TEXT("Could not get GameUserSettings"));
+		return HardwareBenchmark;
 	}
 
-	UE_LOG(LogNohamSettings, Log, TEXT("VSync %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
-	return true;
-}
+	// The governor must not react to the benchmark's load
+	const bool bWasLocked = IsAdaptiveQualityLocked();
+	SetAdaptiveQualityLocked(true);
 
-bool UNohamSettingsSubsystem::SetFrameRateLimit(int32 Limit)
-{
-	if (Limit < 0 || (Limit > 0 && Limit < 30))
+	const double StartTime = FPlatformTime::Seconds();
+	UserSettings->RunHardwareBenchmark();
+	SetAdaptiveQualityLocked(bWasLocked);
+
+	FNohamHardwareBenchmark Result;
+	Result.CPUScore = UserSettings->GetLastCPUBenchmarkResult();
+	Result.GPUScore = UserSettings->GetLastGPUBenchmarkResult();
+
+	// The benchmark also wrote its own scalability levels into GameUserSettings, ours stay authoritative
+	NohamSettings::SetUserScalability(UserSettings, AppliedGraphicsSettings);
+
+	if (!Result.IsValid())
 	{
-		UE_LOG(LogNohamSettings, Error, TEXT("Invalid frame rate limit: %d"), Limit);
-		return false;
+		UE_LOG(LogNohamSettings, Warning, TEXT("Hardware benchmark failed (CPU %.1f, GPU %.1f)"), Result.CPUScore, Result.GPUScore);
+		return HardwareBenchmark;
 	}
 
-	GraphicsSettings.FrameRateLimit = Limit;
+	// The weaker of the two decides
+	const int32 Preset = FMath::Min(NohamSettings::ScoreToPreset(Result.CPUScore), NohamSettings::ScoreToPreset(Result.GPUScore));
+	Result.RecommendedQualityPreset = Preset;
+	Result.RecommendedResolutionScale = NohamSettings::PresetResolutionScale[Preset];
+	Result.RecommendedFrameRateLimit = NohamSettings::PresetFrameRateLimit[Preset];
+	Result.HardwareFingerprint = NohamSettings::GetHardwareFingerprint();
+	Result.Timestamp = FDateTime::UtcNow();
+	HardwareBenchmark = Result;
 
-	UGameUserSettings* UserSettings = GEngine->GetGameUserSettings();
-	if (UserSettings)
+	UE_LOG(LogNohamSettings, Log, TEXT("Hardware benchmark: CPU %.1f, GPU %.1f -> preset %d, scale %.0f, limit %d (%.0f ms)"),
+		Result.CPUScore, Result.GPUScore, Preset, Result.RecommendedResolutionScale, Result.RecommendedFrameRateLimit,
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	if (bApplyRecommended)
 	{
-		UserSettings->SetFrameRateLimit(Limit > 0 ? Limit : 0);
-		UserSettings->ApplySettings(false);
-		UserSettings->SaveSettings();
+		BeginGraphicsTransaction();
+		PendingGraphicsSettings.QualityPreset = Result.RecommendedQualityPreset;
+		NohamSettings::ClearGroupLevels(PendingGraphicsSettings);
+		PendingGraphicsSettings.ResolutionScale = Result.RecommendedResolutionScale;
+		PendingGraphicsSettings.FrameRateLimit = Result.RecommendedFrameRateLimit;
+		CommitGraphicsTransaction();
 	}
 
-	UE_LOG(LogNohamSettings, Log, TEXT("Frame rate limit set to: %d"), Limit);
-	return true;
+	// Persist the result even if nothing was applied
+	MarkSettingsDirty(ENohamSettingsCategory::Graphics);
+	OnHardwareBenchmarkCompleted.Broadcast(HardwareBenchmark);
+	return HardwareBenchmark;
 }
 
-bool UNohamSettingsSubsystem::SetQualityPreset(int32 Preset)
+void UNohamSettingsSubsystem::RunFirstLaunchBenchmark()
 {
-	if (Preset < 0 || Preset > 3)
+	// New hardware or a missing benchmark with saved settings: keep what the user chose
+	RunHardwareBenchmark(!bLoadedGraphicsSettings);
+}
+
+void UNohamSettingsSubsystem::BeginGraphicsTransaction()
+{
+	if (GraphicsTransactionDepth++ == 0)
 	{
-		UE_LOG(LogNohamSettings, Error, TEXT("Invalid quality preset: %d"), Preset);
-		return false;
+		PendingGraphicsSettings = GraphicsSettings;
 	}
+}
 
-	GraphicsSettings.QualityPreset = Preset;
+FNohamGraphicsApplyResult UNohamSettingsSubsystem::CommitGraphicsTransaction()
+{
+	if (GraphicsTransactionDepth == 0)
+	{
+		UE_LOG(LogNohamSettings, Warning, TEXT("CommitGraphicsTransaction without BeginGraphicsTransaction"));
+		return FNohamGraphicsApplyResult();
+	}
+	if (--GraphicsTransactionDepth > 0)
+	{
+		return FNohamGraphicsApplyResult();
+	}
 
-	UGameUserSettings* UserSettings = GEngine->GetGameUserSettings();
-	if (UserSettings)
+	GraphicsSettings = PendingGraphicsSettings;
+	FNohamGraphicsApplyResult Result = ApplyGraphicsSettings();
+	if (Result.HasChanges())
 	{
-		UserSettings->SetOverallScalabilityLevel(Preset);
-		UserSettings->ApplySettings(false);
-		UserSettings->SaveSettings();
+		MarkSettingsDirty(ENohamSettingsCategory::Graphics);
 	}
+	return Result;
+}
 
-	UE_LOG(LogNohamSettings, Log, TEXT("Quality preset set to: %d"), Preset);
-	return true;
+void UNohamSettingsSubsystem::CancelGraphicsTransaction()
+{
+	if (GraphicsTransactionDepth > 0)
+	{
+		UE_LOG(LogNohamSettings, Log, TEXT("Graphics transaction cancelled"));
+	}
+	GraphicsTransactionDepth = 0;
 }
 
 // ======== Audio Settings ========
@@ -219,6 +1236,7 @@ bool UNohamSettingsSubsystem::UpdateAudioSettings(const FNohamAudioSettings& New
 
 	AudioSettings = NewSettings;
 	ApplyAudioSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Audio);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Audio settings updated: Master=%.2f, Music=%.2f, SFX=%.2f, Voice=%.2f"),
 		AudioSettings.MasterVolume, AudioSettings.MusicVolume,
@@ -237,6 +1255,7 @@ bool UNohamSettingsSubsystem::SetMasterVolume(float Volume)
 
 	AudioSettings.MasterVolume = Volume;
 	ApplyAudioSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Audio);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Master volume set to: %.2f"), Volume);
 	return true;
@@ -252,6 +1271,7 @@ bool UNohamSettingsSubsystem::SetMusicVolume(float Volume)
 
 	AudioSettings.MusicVolume = Volume;
 	ApplyAudioSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Audio);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Music volume set to: %.2f"), Volume);
 	return true;
@@ -267,6 +1287,7 @@ bool UNohamSettingsSubsystem::SetSFXVolume(float Volume)
 
 	AudioSettings.SFXVolume = Volume;
 	ApplyAudioSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Audio);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("SFX volume set to: %.2f"), Volume);
 	return true;
@@ -282,6 +1303,7 @@ bool UNohamSettingsSubsystem::SetVoiceVolume(float Volume)
 
 	AudioSettings.VoiceVolume = Volume;
 	ApplyAudioSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Audio);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Voice volume set to: %.2f"), Volume);
 	return true;
@@ -308,6 +1330,7 @@ bool UNohamSettingsSubsystem::SetAudioDevice(const FString& DeviceId)
 	}
 
 	AudioSettings.SelectedAudioDeviceId = DeviceId;
+	MarkSettingsDirty(ENohamSettingsCategory::Audio);
 
 	// TODO: Apply audio device change through UE5 audio system when NEON is fully integrated
 	// For now, just store the preference
@@ -365,6 +1388,7 @@ bool UNohamSettingsSubsystem::UpdateInputSettings(const FNohamInputSettings& New
 
 	InputSettings = NewSettings;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Input settings updated: MouseSens=%.2f/%.2f, GamepadSens=%.2f/%.2f"),
 		InputSettings.MouseSensitivityX, InputSettings.MouseSensitivityY,
@@ -383,6 +1407,7 @@ bool UNohamSettingsSubsystem::SetMouseSensitivityX(float Sensitivity)
 
 	InputSettings.MouseSensitivityX = Sensitivity;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Mouse sensitivity X set to: %.2f"), Sensitivity);
 	return true;
@@ -398,6 +1423,7 @@ bool UNohamSettingsSubsystem::SetMouseSensitivityY(float Sensitivity)
 
 	InputSettings.MouseSensitivityY = Sensitivity;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Mouse sensitivity Y set to: %.2f"), Sensitivity);
 	return true;
@@ -413,6 +1439,7 @@ bool UNohamSettingsSubsystem::SetADSSensitivityMultiplier(float Multiplier)
 
 	InputSettings.ADSSensitivityMultiplier = Multiplier;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("ADS sensitivity multiplier set to: %.2f"), Multiplier);
 	return true;
@@ -422,6 +1449,7 @@ bool UNohamSettingsSubsystem::SetInvertMouseY(bool bInvert)
 {
 	InputSettings.bInvertMouseY = bInvert;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Mouse Y inversion %s"), bInvert ? TEXT("enabled") : TEXT("disabled"));
 	return true;
@@ -437,6 +1465,7 @@ bool UNohamSettingsSubsystem::SetGamepadSensitivityX(float Sensitivity)
 
 	InputSettings.GamepadSensitivityX = Sensitivity;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Gamepad sensitivity X set to: %.2f"), Sensitivity);
 	return true;
@@ -452,6 +1481,7 @@ bool UNohamSettingsSubsystem::SetGamepadSensitivityY(float Sensitivity)
 
 	InputSettings.GamepadSensitivityY = Sensitivity;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Gamepad sensitivity Y set to: %.2f"), Sensitivity);
 	return true;
@@ -461,6 +1491,7 @@ bool UNohamSettingsSubsystem::SetInvertGamepadY(bool bInvert)
 {
 	InputSettings.bInvertGamepadY = bInvert;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Gamepad Y inversion %s"), bInvert ? TEXT("enabled") : TEXT("disabled"));
 	return true;
@@ -476,6 +1507,7 @@ bool UNohamSettingsSubsystem::SetLeftStickDeadZone(float DeadZone)
 
 	InputSettings.LeftStickDeadZone = DeadZone;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Left stick dead zone set to: %.2f"), DeadZone);
 	return true;
@@ -491,6 +1523,7 @@ bool UNohamSettingsSubsystem::SetRightStickDeadZone(float DeadZone)
 
 	InputSettings.RightStickDeadZone = DeadZone;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Right stick dead zone set to: %.2f"), DeadZone);
 	return true;
@@ -500,6 +1533,7 @@ bool UNohamSettingsSubsystem::SetEnableVibration(bool bEnable)
 {
 	InputSettings.bEnableVibration = bEnable;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Vibration %s"), bEnable ? TEXT("enabled") : TEXT("disabled"));
 	return true;
@@ -515,6 +1549,7 @@ bool UNohamSettingsSubsystem::SetVibrationIntensity(float Intensity)
 
 	InputSettings.VibrationIntensity = Intensity;
 	ApplyInputSettings();
+	MarkSettingsDirty(ENohamSettingsCategory::Input);
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Vibration intensity set to: %.2f"), Intensity);
 	return true;
@@ -581,142 +1616,229 @@ bool UNohamSettingsSubsystem::ValidateInputSettings(const FNohamInputSettings& N
 
 bool UNohamSettingsSubsystem::SaveSettings()
 {
-	// Create JSON object for all settings
-	TSharedPtr<FJsonObject> SettingsObject = MakeShareable(new FJsonObject());
+	// Supersedes any pending flush
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(SaveDebounceTimer);
+	}
+	WaitForPendingSave();
+
+	if (UGameUserSettings* UserSettings = GEngine->GetGameUserSettings())
+	{
+		UserSettings->SaveSettings();
+	}
+	DirtyCategories = ENohamSettingsCategory::None;
+
+	// Write combined settings to file
+	TArray<uint8> Data;
+	NohamSettings::SerializeSettingsBinary(GraphicsSettings, AudioSettings, InputSettings, HardwareBenchmark, Data);
+
+	FString FilePath = GetSettingsFilePath();
+	if (NohamSettings::SaveArrayToFileAtomic(Data, FilePath))
+	{
+		UE_LOG(LogNohamSettings, Log, TEXT("Settings saved to: %s"), *FilePath);
+		return true;
+	}
+
+	UE_LOG(LogNohamSettings, Error, TEXT("Failed to save settings"));
+	return false;
+}
+
+void UNohamSettingsSubsystem::FlushSettings()
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(SaveDebounceTimer);
+	}
+
+	if (DirtyCategories == ENohamSettingsCategory::None)
+	{
+		return;
+	}
 
-	// Serialize graphics settings
-	FString GraphicsJson;
-	if (FJsonObjectConverter::UStructToJsonObjectString(GraphicsSettings, GraphicsJson))
+	// GameUserSettings is a UObject config, its ini has to be written on the game thread
+	if (EnumHasAnyFlags(DirtyCategories, ENohamSettingsCategory::Graphics))
 	{
-		TSharedPtr<FJsonObject> GraphicsObj;
-		TSharedRef<TJsonReader<>> GraphicsReader = TJsonReaderFactory<>::Create(GraphicsJson);
-		if (FJsonSerializer::Deserialize(GraphicsReader, GraphicsObj) && GraphicsObj.IsValid())
+		if (UGameUserSettings* UserSettings = GEngine->GetGameUserSettings())
 		{
-			SettingsObject->SetObjectField(TEXT("Graphics"), GraphicsObj);
+			UserSettings->SaveSettings();
 		}
 	}
+	DirtyCategories = ENohamSettingsCategory::None;
+
+	// Keep writes in order, the previous one is usually long done
+	WaitForPendingSave();
+
+	// Snapshot by value, the task must not touch the subsystem
+	PendingSave = Async(EAsyncExecution::ThreadPool,
+		[Graphics = GraphicsSettings, Audio = AudioSettings, Input = InputSettings, Benchmark = HardwareBenchmark,
+			FilePath = GetSettingsFilePath()]()
+		{
+			TArray<uint8> Data;
+			NohamSettings::SerializeSettingsBinary(Graphics, Audio, Input, Benchmark, Data);
+			if (NohamSettings::SaveArrayToFileAtomic(Data, FilePath))
+			{
+				UE_LOG(LogNohamSettings, Verbose, TEXT("Settings saved to: %s"), *FilePath);
+				return true;
+			}
+			UE_LOG(LogNohamSettings, Error, TEXT("Failed to save settings"));
+			return false;
+		});
+}
+
+bool UNohamSettingsSubsystem::LoadSettings()
+{
+	const FString FilePath = GetSettingsFilePath();
 
-	// Serialize audio settings
-	FString AudioJson;
-	if (FJsonObjectConverter::UStructToJsonObjectString(AudioSettings, AudioJson))
+	// Whole blob in one read, no text parsing on the startup path
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *FilePath, FILEREAD_Silent) && !NohamSettings::RecoverTempFile(FilePath, Data))
 	{
-		TSharedPtr<FJsonObject> AudioObj;
-		TSharedRef<TJsonReader<>> AudioReader = TJsonReaderFactory<>::Create(AudioJson);
-		if (FJsonSerializer::Deserialize(AudioReader, AudioObj) && AudioObj.IsValid())
+		// First run with the binary store, carry over the old JSON settings
+		const FString LegacyPath = GetLegacySettingsFilePath();
+		if (FPaths::FileExists(LegacyPath) && LoadLegacySettings(LegacyPath))
 		{
-			SettingsObject->SetObjectField(TEXT("Audio"), AudioObj);
+			UE_LOG(LogNohamSettings, Log, TEXT("Migrated settings from %s"), *LegacyPath);
+			SaveSettings();
+			BroadcastSettingsChanges();
+			return true;
+		}
+
+		UE_LOG(LogNohamSettings, Log, TEXT("No saved settings, using defaults"));
+		return false;
+	}
+
+	TMap<FString, TArray<uint8>> Categories;
+	NohamSettings::FBinaryArchiveVersions Versions;
+	bool bSchemaChanged = false;
+	if (!NohamSettings::ParseSettingsBinary(Data, Categories, Versions, bSchemaChanged))
+	{
+		UE_LOG(LogNohamSettings, Warning, TEXT("Settings file is not readable by this build, using defaults: %s"), *FilePath);
+		return false;
+	}
+
+	bool bSuccess = true;
+
+	if (const TArray<uint8>* Payload = Categories.Find(TEXT("Graphics")))
+	{
+		if (NohamSettings::ReadCategory(*Payload, Versions, GraphicsSettings))
+		{
+			ApplyGraphicsSettings();
+			bLoadedGraphicsSettings = true;
+		}
+		else
+		{
+			bSuccess = false;
 		}
 	}
 
-	// Serialize input settings
-	FString InputJson;
-	if (FJsonObjectConverter::UStructToJsonObjectString(InputSettings, InputJson))
+	if (const TArray<uint8>* Payload = Categories.Find(TEXT("Audio")))
 	{
-		TSharedPtr<FJsonObject> InputObj;
-		TSharedRef<TJsonReader<>> InputReader = TJsonReaderFactory<>::Create(InputJson);
-		if (FJsonSerializer::Deserialize(InputReader, InputObj) && InputObj.IsValid())
+		if (NohamSettings::ReadCategory(*Payload, Versions, AudioSettings))
 		{
-			SettingsObject->SetObjectField(TEXT("Input"), InputObj);
+			ApplyAudioSettings();
+		}
+		else
+		{
+			bSuccess = false;
 		}
 	}
 
-	// Write combined settings to file
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	if (FJsonSerializer::Serialize(SettingsObject.ToSharedRef(), Writer))
+	if (const TArray<uint8>* Payload = Categories.Find(TEXT("Input")))
 	{
-		FString FilePath = GetSettingsFilePath();
-		if (FFileHelper::SaveStringToFile(OutputString, *FilePath))
+		if (NohamSettings::ReadCategory(*Payload, Versions, InputSettings))
 		{
-			UE_LOG(LogNohamSettings, Log, TEXT("Settings saved to: %s"), *FilePath);
-			return true;
+			ApplyInputSettings();
+		}
+		else
+		{
+			bSuccess = false;
 		}
 	}
 
-	UE_LOG(LogNohamSettings, Error, TEXT("Failed to save settings"));
-	return false;
+	// Losing this only means benchmarking again
+	if (const TArray<uint8>* Payload = Categories.Find(TEXT("Benchmark")))
+	{
+		NohamSettings::ReadCategory(*Payload, Versions, HardwareBenchmark);
+	}
+
+	if (!bSuccess)
+	{
+		UE_LOG(LogNohamSettings, Warning, TEXT("Could not load settings, using defaults"));
+		return false;
+	}
+
+	// Written by a build with different settings structs or an older container, store it again in the current layout
+	if (bSchemaChanged)
+	{
+		MarkSettingsDirty(ENohamSettingsCategory::All);
+	}
+	BroadcastSettingsChanges();
+
+	UE_LOG(LogNohamSettings, Log, TEXT("Settings loaded from: %s"), *FilePath);
+	return true;
 }
 
-bool UNohamSettingsSubsystem::LoadSettings()
+bool UNohamSettingsSubsystem::LoadLegacySettings(const FString& FilePath)
 {
-	FString FilePath = GetSettingsFilePath();
 	FString JsonString;
 
 	if (FFileHelper::LoadFileToString(JsonString, *FilePath))
 	{
-		TSharedPtr<FJsonObject> SettingsObject;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+		TSharedPtr<FJsonObject> SettingsObject = NohamSettings::ParseSettings(JsonString);
 
-		if (FJsonSerializer::Deserialize(Reader, SettingsObject) && SettingsObject.IsValid())
+		if (SettingsObject.IsValid())
 		{
 			bool bSuccess = true;
 
 			// Load graphics settings
-			if (SettingsObject->HasField(TEXT("Graphics")))
+			if (TSharedPtr<FJsonObject> GraphicsObj = NohamSettings::GetCategory(SettingsObject, TEXT("Graphics")))
 			{
-				TSharedPtr<FJsonObject> GraphicsObj = SettingsObject->GetObjectField(TEXT("Graphics"));
-				FString GraphicsJson;
-				TSharedRef<TJsonWriter<>> GraphicsWriter = TJsonWriterFactory<>::Create(&GraphicsJson);
-				if (FJsonSerializer::Serialize(GraphicsObj.ToSharedRef(), GraphicsWriter))
+				if (NohamSettings::JsonToStruct(GraphicsObj, GraphicsSettings))
 				{
-					if (FJsonObjectConverter::JsonObjectStringToUStruct(GraphicsJson, &GraphicsSettings, 0, 0))
-					{
-						ApplyGraphicsSettings();
-					}
-					else
-					{
-						bSuccess = false;
-					}
+					ApplyGraphicsSettings();
+					bLoadedGraphicsSettings = true;
+				}
+				else
+				{
+					bSuccess = false;
 				}
 			}
 
 			// Load audio settings
-			if (SettingsObject->HasField(TEXT("Audio")))
+			if (TSharedPtr<FJsonObject> AudioObj = NohamSettings::GetCategory(SettingsObject, TEXT("Audio")))
 			{
-				TSharedPtr<FJsonObject> AudioObj = SettingsObject->GetObjectField(TEXT("Audio"));
-				FString AudioJson;
-				TSharedRef<TJsonWriter<>> AudioWriter = TJsonWriterFactory<>::Create(&AudioJson);
-				if (FJsonSerializer::Serialize(AudioObj.ToSharedRef(), AudioWriter))
+				if (NohamSettings::JsonToStruct(AudioObj, AudioSettings))
 				{
-					if (FJsonObjectConverter::JsonObjectStringToUStruct(AudioJson, &AudioSettings, 0, 0))
-					{
-						ApplyAudioSettings();
-					}
-					else
-					{
-						bSuccess = false;
-					}
+					ApplyAudioSettings();
+				}
+				else
+				{
+					bSuccess = false;
 				}
 			}
 
 			// Load input settings
-			if (SettingsObject->HasField(TEXT("Input")))
+			if (TSharedPtr<FJsonObject> InputObj = NohamSettings::GetCategory(SettingsObject, TEXT("Input")))
 			{
-				TSharedPtr<FJsonObject> InputObj = SettingsObject->GetObjectField(TEXT("Input"));
-				FString InputJson;
-				TSharedRef<TJsonWriter<>> InputWriter = TJsonWriterFactory<>::Create(&InputJson);
-				if (FJsonSerializer::Serialize(InputObj.ToSharedRef(), InputWriter))
+				if (NohamSettings::JsonToStruct(InputObj, InputSettings))
 				{
-					if (FJsonObjectConverter::JsonObjectStringToUStruct(InputJson, &InputSettings, 0, 0))
-					{
-						ApplyInputSettings();
-					}
-					else
-					{
-						bSuccess = false;
-					}
+					ApplyInputSettings();
+				}
+				else
+				{
+					bSuccess = false;
 				}
 			}
 
 			if (bSuccess)
 			{
-				UE_LOG(LogNohamSettings, Log, TEXT("Settings loaded from: %s"), *FilePath);
 				return true;
 			}
 		}
 	}
 
-	UE_LOG(LogNohamSettings, Warning, TEXT("Could not load settings, using defaults"));
+	UE_LOG(LogNohamSettings, Warning, TEXT("Could not read legacy settings: %s"), *FilePath);
 	return false;
 }
 
@@ -727,6 +1849,7 @@ void UNohamSettingsSubsystem::ResetToDefaults()
 	ApplyAudioSettings();
 	ApplyInputSettings();
 	SaveSettings();
+	BroadcastSettingsChanges();
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Settings reset to defaults"));
 }
@@ -741,49 +1864,12 @@ bool UNohamSettingsSubsystem::BackupSettings()
 	// Optionally save backup to file
 	FString BackupPath = GetBackupFilePath();
 
-	TSharedPtr<FJsonObject> BackupObject = MakeShareable(new FJsonObject());
-
-	// Serialize all settings to backup
-	FString GraphicsJson, AudioJson, InputJson;
-	if (FJsonObjectConverter::UStructToJsonObjectString(GraphicsSettings, GraphicsJson))
-	{
-		TSharedPtr<FJsonObject> GraphicsObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(GraphicsJson);
-		if (FJsonSerializer::Deserialize(Reader, GraphicsObj))
-		{
-			BackupObject->SetObjectField(TEXT("Graphics"), GraphicsObj);
-		}
-	}
-
-	if (FJsonObjectConverter::UStructToJsonObjectString(AudioSettings, AudioJson))
-	{
-		TSharedPtr<FJsonObject> AudioObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(AudioJson);
-		if (FJsonSerializer::Deserialize(Reader, AudioObj))
-		{
-			BackupObject->SetObjectField(TEXT("Audio"), AudioObj);
-		}
-	}
-
-	if (FJsonObjectConverter::UStructToJsonObjectString(InputSettings, InputJson))
-	{
-		TSharedPtr<FJsonObject> InputObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputJson);
-		if (FJsonSerializer::Deserialize(Reader, InputObj))
-		{
-			BackupObject->SetObjectField(TEXT("Input"), InputObj);
-		}
-	}
-
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	if (FJsonSerializer::Serialize(BackupObject.ToSharedRef(), Writer))
+	TArray<uint8> Data;
+	NohamSettings::SerializeSettingsBinary(GraphicsSettings, AudioSettings, InputSettings, HardwareBenchmark, Data);
+	if (NohamSettings::SaveArrayToFileAtomic(Data, BackupPath))
 	{
-		if (FFileHelper::SaveStringToFile(OutputString, *BackupPath))
-		{
-			UE_LOG(LogNohamSettings, Log, TEXT("Settings backup created: %s"), *BackupPath);
-			return true;
-		}
+		UE_LOG(LogNohamSettings, Log, TEXT("Settings backup created: %s"), *BackupPath);
+		return true;
 	}
 
 	UE_LOG(LogNohamSettings, Warning, TEXT("Settings backup to file failed, using memory backup only"));
@@ -806,6 +1892,7 @@ bool UNohamSettingsSubsystem::RestoreFromBackup()
 	ApplyAudioSettings();
 	ApplyInputSettings();
 	SaveSettings();
+	BroadcastSettingsChanges();
 
 	UE_LOG(LogNohamSettings, Log, TEXT("Settings restored from backup"));
 	return true;
@@ -824,47 +1911,15 @@ bool UNohamSettingsSubsystem::ExportSettings(const FString& FilePath)
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> ExportObject = MakeShareable(new FJsonObject());
+	TSharedRef<FJsonObject> ExportObject = NohamSettings::SettingsToJson(GraphicsSettings, AudioSettings, InputSettings);
 
 	// Add version info
 	ExportObject->SetStringField(TEXT("Version"), TEXT("1.0"));
 	ExportObject->SetStringField(TEXT("ExportDate"), FDateTime::Now().ToString());
 
-	// Serialize all settings
-	FString GraphicsJson, AudioJson, InputJson;
-	if (FJsonObjectConverter::UStructToJsonObjectString(GraphicsSettings, GraphicsJson))
-	{
-		TSharedPtr<FJsonObject> GraphicsObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(GraphicsJson);
-		if (FJsonSerializer::Deserialize(Reader, GraphicsObj))
-		{
-			ExportObject->SetObjectField(TEXT("Graphics"), GraphicsObj);
-		}
-	}
-
-	if (FJsonObjectConverter::UStructToJsonObjectString(AudioSettings, AudioJson))
-	{
-		TSharedPtr<FJsonObject> AudioObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(AudioJson);
-		if (FJsonSerializer::Deserialize(Reader, AudioObj))
-		{
-			ExportObject->SetObjectField(TEXT("Audio"), AudioObj);
-		}
-	}
-
-	if (FJsonObjectConverter::UStructToJsonObjectString(InputSettings, InputJson))
-	{
-		TSharedPtr<FJsonObject> InputObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputJson);
-		if (FJsonSerializer::Deserialize(Reader, InputObj))
-		{
-			ExportObject->SetObjectField(TEXT("Input"), InputObj);
-		}
-	}
-
 	FString OutputString;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	if (FJsonSerializer::Serialize(ExportObject.ToSharedRef(), Writer))
+	if (FJsonSerializer::Serialize(ExportObject, Writer))
 	{
 		if (FFileHelper::SaveStringToFile(OutputString, *FilePath))
 		{
@@ -892,9 +1947,8 @@ bool UNohamSettingsSubsystem::ImportSettings(const FString& FilePath)
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> ImportObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(Reader, ImportObject) || !ImportObject.IsValid())
+	TSharedPtr<FJsonObject> ImportObject = NohamSettings::ParseSettings(JsonString);
+	if (!ImportObject.IsValid())
 	{
 		UE_LOG(LogNohamSettings, Error, TEXT("Failed to parse import file"));
 		return false;
@@ -906,70 +1960,52 @@ bool UNohamSettingsSubsystem::ImportSettings(const FString& FilePath)
 	bool bSuccess = true;
 
 	// Import graphics settings
-	if (ImportObject->HasField(TEXT("Graphics")))
+	if (TSharedPtr<FJsonObject> GraphicsObj = NohamSettings::GetCategory(ImportObject, TEXT("Graphics")))
 	{
-		TSharedPtr<FJsonObject> GraphicsObj = ImportObject->GetObjectField(TEXT("Graphics"));
-		FString GraphicsJson;
-		TSharedRef<TJsonWriter<>> GraphicsWriter = TJsonWriterFactory<>::Create(&GraphicsJson);
-		if (FJsonSerializer::Serialize(GraphicsObj.ToSharedRef(), GraphicsWriter))
+		FNohamGraphicsSettings NewGraphics;
+		if (NohamSettings::JsonToStruct(GraphicsObj, NewGraphics))
 		{
-			FNohamGraphicsSettings NewGraphics;
-			if (FJsonObjectConverter::JsonObjectStringToUStruct(GraphicsJson, &NewGraphics, 0, 0))
+			if (ValidateGraphicsSettings(NewGraphics))
 			{
-				if (ValidateGraphicsSettings(NewGraphics))
-				{
-					GraphicsSettings = NewGraphics;
-				}
-				else
-				{
-					bSuccess = false;
-				}
+				GraphicsSettings = NewGraphics;
+			}
+			else
+			{
+				bSuccess = false;
 			}
 		}
 	}
 
 	// Import audio settings
-	if (ImportObject->HasField(TEXT("Audio")))
+	if (TSharedPtr<FJsonObject> AudioObj = NohamSettings::GetCategory(ImportObject, TEXT("Audio")))
 	{
-		TSharedPtr<FJsonObject> AudioObj = ImportObject->GetObjectField(TEXT("Audio"));
-		FString AudioJson;
-		TSharedRef<TJsonWriter<>> AudioWriter = TJsonWriterFactory<>::Create(&AudioJson);
-		if (FJsonSerializer::Serialize(AudioObj.ToSharedRef(), AudioWriter))
+		FNohamAudioSettings NewAudio;
+		if (NohamSettings::JsonToStruct(AudioObj, NewAudio))
 		{
-			FNohamAudioSettings NewAudio;
-			if (FJsonObjectConverter::JsonObjectStringToUStruct(AudioJson, &NewAudio, 0, 0))
+			if (ValidateAudioSettings(NewAudio))
 			{
-				if (ValidateAudioSettings(NewAudio))
-				{
-					AudioSettings = NewAudio;
-				}
-				else
-				{
-					bSuccess = false;
-				}
+				AudioSettings = NewAudio;
+			}
+			else
+			{
+				bSuccess = false;
 			}
 		}
 	}
 
 	// Import input settings
-	if (ImportObject->HasField(TEXT("Input")))
+	if (TSharedPtr<FJsonObject> InputObj = NohamSettings::GetCategory(ImportObject, TEXT("Input")))
 	{
-		TSharedPtr<FJsonObject> InputObj = ImportObject->GetObjectField(TEXT("Input"));
-		FString InputJson;
-		TSharedRef<TJsonWriter<>> InputWriter = TJsonWriterFactory<>::Create(&InputJson);
-		if (FJsonSerializer::Serialize(InputObj.ToSharedRef(), InputWriter))
+		FNohamInputSettings NewInput;
+		if (NohamSettings::JsonToStruct(InputObj, NewInput))
 		{
-			FNohamInputSettings NewInput;
-			if (FJsonObjectConverter::JsonObjectStringToUStruct(InputJson, &NewInput, 0, 0))
+			if (ValidateInputSettings(NewInput))
 			{
-				if (ValidateInputSettings(NewInput))
-				{
-					InputSettings = NewInput;
-				}
-				else
-				{
-					bSuccess = false;
-				}
+				InputSettings = NewInput;
+			}
+			else
+			{
+				bSuccess = false;
 			}
 		}
 	}
@@ -980,6 +2016,7 @@ bool UNohamSettingsSubsystem::ImportSettings(const FString& FilePath)
 		ApplyAudioSettings();
 		ApplyInputSettings();
 		SaveSettings();
+		BroadcastSettingsChanges();
 		UE_LOG(LogNohamSettings, Log, TEXT("Settings imported successfully from: %s"), *FilePath);
 	}
 	else
@@ -1013,6 +2050,60 @@ bool UNohamSettingsSubsystem::RevertSettings()
 	return RestoreFromBackup();
 }
 
+void UNohamSettingsSubsystem::MarkSettingsDirty(ENohamSettingsCategory Category)
+{
+	// Every setter commits through here
+	BroadcastSettingsChanges();
+
+	DirtyCategories |= Category;
+
+	// Restarting the timer on every change keeps a slider drag down to one write after it settles
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().SetTimer(SaveDebounceTimer, this, &UNohamSettingsSubsystem::FlushSettings, SaveDebounceSeconds, false);
+	}
+}
+
+void UNohamSettingsSubsystem::BroadcastSettingsChanges()
+{
+	// Snapshots are advanced before broadcasting, a handler that changes settings again gets its own event
+	if (!NohamSettings::IsSameSettings(GraphicsSettings, NotifiedGraphicsSettings))
+	{
+		const FNohamGraphicsSettings OldSettings = NotifiedGraphicsSettings;
+		const FNohamGraphicsSettings NewSettings = GraphicsSettings;
+		NotifiedGraphicsSettings = NewSettings;
+		NohamSettings::PublishSettingsDelta(NohamSettings::GraphicsTopic, OldSettings, NewSettings);
+		OnGraphicsSettingsChanged.Broadcast(OldSettings, NewSettings);
+	}
+
+	if (!NohamSettings::IsSameSettings(AudioSettings, NotifiedAudioSettings))
+	{
+		const FNohamAudioSettings OldSettings = NotifiedAudioSettings;
+		const FNohamAudioSettings NewSettings = AudioSettings;
+		NotifiedAudioSettings = NewSettings;
+		NohamSettings::PublishSettingsDelta(NohamSettings::AudioTopic, OldSettings, NewSettings);
+		OnAudioSettingsChanged.Broadcast(OldSettings, NewSettings);
+	}
+
+	if (!NohamSettings::IsSameSettings(InputSettings, NotifiedInputSettings))
+	{
+		const FNohamInputSettings OldSettings = NotifiedInputSettings;
+		const FNohamInputSettings NewSettings = InputSettings;
+		NotifiedInputSettings = NewSettings;
+		NohamSettings::PublishSettingsDelta(NohamSettings::InputTopic, OldSettings, NewSettings);
+		OnInputSettingsChanged.Broadcast(OldSettings, NewSettings);
+	}
+}
+
+void UNohamSettingsSubsystem::WaitForPendingSave()
+{
+	if (PendingSave.IsValid())
+	{
+		PendingSave.Wait();
+		PendingSave.Reset();
+	}
+}
+
 bool UNohamSettingsSubsystem::ValidateGraphicsSettings(const FNohamGraphicsSettings& NewSettings)
 {
 	// Validate resolution
@@ -1036,6 +2127,14 @@ bool UNohamSettingsSubsystem::ValidateGraphicsSettings(const FNohamGraphicsSetti
 		return false;
 	}
 
+	// Validate frame rate policy
+	if (NewSettings.MenuFrameRateLimit < 0 || (NewSettings.MenuFrameRateLimit > 0 && NewSettings.MenuFrameRateLimit < 10)
+		|| NewSettings.BackgroundFrameRateLimit < 0 || (NewSettings.BackgroundFrameRateLimit > 0 && NewSettings.BackgroundFrameRateLimit < 5))
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid frame rate policy"));
+		return false;
+	}
+
 	// Validate quality preset
 	if (NewSettings.QualityPreset < 0 || NewSettings.QualityPreset > 3)
 	{
@@ -1043,45 +2142,104 @@ bool UNohamSettingsSubsystem::ValidateGraphicsSettings(const FNohamGraphicsSetti
 		return false;
 	}
 
+	// Validate per group levels
+	for (const NohamSettings::FScalabilityGroupBinding& Binding : NohamSettings::ScalabilityGroupBindings)
+	{
+		if (NewSettings.*Binding.Field < -1 || NewSettings.*Binding.Field > 3)
+		{
+			UE_LOG(LogNohamSettings, Error, TEXT("Invalid scalability group level"));
+			return false;
+		}
+	}
+
+	// Validate resolution scale
+	if (NewSettings.ResolutionScale < 25.0f || NewSettings.ResolutionScale > 100.0f)
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid resolution scale"));
+		return false;
+	}
+
+	// Validate adaptive quality
+	if (NewSettings.TargetFrameTimeMs < 4.0f || NewSettings.TargetFrameTimeMs > 50.0f
+		|| NewSettings.MinAdaptiveResolutionScale < 25.0f || NewSettings.MinAdaptiveResolutionScale > 100.0f)
+	{
+		UE_LOG(LogNohamSettings, Error, TEXT("Invalid adaptive quality settings"));
+		return false;
+	}
+
 	return true;
 }
 
 // ======== Private Helper Functions ========
 
-void UNohamSettingsSubsystem::ApplyGraphicsSettings()
+FNohamGraphicsApplyResult UNohamSettingsSubsystem::ApplyGraphicsSettings()
 {
+	FNohamGraphicsApplyResult Result;
+
 	UGameUserSettings* UserSettings = GEngine->GetGameUserSettings();
 	if (!UserSettings)
 	{
 		UE_LOG(LogNohamSettings, Error, TEXT("Could not get GameUserSettings"));
-		return;
+		return Result;
+	}
+
+	// Measuring would otherwise overwrite what is applied here when it restores its levels
+	CancelScalabilityProfiling();
+
+	// Only what differs from the last apply reaches the engine, everything on the first one
+	const FNohamGraphicsSettings& Applied = AppliedGraphicsSettings;
+	const bool bForce = !bHasAppliedGraphics;
+	Result.bResolutionChanged = bForce || GraphicsSettings.Resolution != Applied.Resolution;
+	Result.bWindowModeChanged = bForce || GraphicsSettings.WindowMode != Applied.WindowMode;
+	Result.bVSyncChanged = bForce || GraphicsSettings.bVSyncEnabled != Applied.bVSyncEnabled;
+	Result.bFrameRateLimitChanged = bForce || GraphicsSettings.FrameRateLimit != Applied.FrameRateLimit;
+	Result.bQualityPresetChanged = bForce || GraphicsSettings.QualityPreset != Applied.QualityPreset;
+	Result.bScalabilityGroupsChanged = bForce || !NohamSettings::HaveSameGroupLevels(GraphicsSettings, Applied);
+	Result.bResolutionScaleChanged = bForce || GraphicsSettings.ResolutionScale != Applied.ResolutionScale;
+	Result.bAdaptiveQualityChanged = bForce || GraphicsSettings.bAdaptiveQuality != Applied.bAdaptiveQuality
+		|| GraphicsSettings.TargetFrameTimeMs != Applied.TargetFrameTimeMs
+		|| GraphicsSettings.MinAdaptiveResolutionScale != Applied.MinAdaptiveResolutionScale;
+	Result.bFrameRatePolicyChanged = bForce || GraphicsSettings.MenuFrameRateLimit != Applied.MenuFrameRateLimit
+		|| GraphicsSettings.BackgroundFrameRateLimit != Applied.BackgroundFrameRateLimit;
+
+	// One swapchain change for resolution and window mode together
+	if (Result.bResolutionChanged || Result.bWindowModeChanged)
+	{
+		UserSettings->SetScreenResolution(GraphicsSettings.Resolution);
+		UserSettings->SetFullscreenMode(NohamSettings::ToEngineWindowMode(GraphicsSettings.WindowMode));
+		UserSettings->ApplyResolutionSettings(false);
+		Result.bResolutionApplied = true;
 	}
 
-	// Apply resolution
-	UserSettings->SetScreenResolution(GraphicsSettings.Resolution);
-
-	// Apply window mode
-	EWindowMode::Type Mode = EWindowMode::Fullscreen;
-	switch (GraphicsSettings.WindowMode)
+	// VSync, frame rate limit and scalability all go through ApplyNonResolutionSettings, call it once
+	// Also when the adaptive mode changed, that puts the levels back to the preset
+	if (Result.bVSyncChanged || Result.bFrameRateLimitChanged || Result.bQualityPresetChanged || Result.bScalabilityGroupsChanged
+		|| Result.bResolutionScaleChanged || Result.bAdaptiveQualityChanged)
 	{
-	case 0: Mode = EWindowMode::Fullscreen; break;
-	case 1: Mode = EWindowMode::Windowed; break;
-	case 2: Mode = EWindowMode::WindowedFullscreen; break;
+		UserSettings->SetVSyncEnabled(GraphicsSettings.bVSyncEnabled);
+		UserSettings->SetFrameRateLimit(GraphicsSettings.FrameRateLimit);
+		NohamSettings::SetUserScalability(UserSettings, GraphicsSettings);
+		UserSettings->ApplyNonResolutionSettings();
+		Result.bScalabilityApplied = true;
 	}
-	UserSettings->SetFullscreenMode(Mode);
 
-	// Apply VSync
-	UserSettings->SetVSyncEnabled(GraphicsSettings.bVSyncEnabled);
+	// The ini is written with the next flush
+	AppliedGraphicsSettings = GraphicsSettings;
+	bHasAppliedGraphics = true;
 
-	// Apply frame rate limit
-	UserSettings->SetFrameRateLimit(GraphicsSettings.FrameRateLimit);
+	// The scalability pass reset the levels the governor was working on
+	UpdateQualityGovernor(Result.bScalabilityApplied);
 
-	// Apply quality preset
-	UserSettings->SetOverallScalabilityLevel(GraphicsSettings.QualityPreset);
+	// The scalability pass wrote the gameplay cap to t.MaxFPS, put the menu or background cap back on top
+	UpdateFrameRatePolicy(Result.bScalabilityApplied);
 
-	// Apply and save
-	UserSettings->ApplySettings(false);
-	UserSettings->SaveSettings();
+	if (Result.HasChanges())
+	{
+		UE_LOG(LogNohamSettings, Verbose, TEXT("Graphics applied: resolution pass %d, scalability pass %d"),
+			Result.bResolutionApplied, Result.bScalabilityApplied);
+		OnGraphicsSettingsApplied.Broadcast(Result);
+	}
+	return Result;
 }
 
 void UNohamSettingsSubsystem::ApplyAudioSettings()
@@ -1138,6 +2296,21 @@ void UNohamSettingsSubsystem::LoadDefaultSettings()
 	GraphicsSettings.bVSyncEnabled = true;
 	GraphicsSettings.FrameRateLimit = 0; // Unlimited
 	GraphicsSettings.QualityPreset = 3; // Epic
+	GraphicsSettings.ResolutionScale = 100.0f;
+	NohamSettings::ClearGroupLevels(GraphicsSettings);
+	GraphicsSettings.bAdaptiveQuality = false;
+	GraphicsSettings.TargetFrameTimeMs = 8.33f;
+	GraphicsSettings.MinAdaptiveResolutionScale = 50.0f;
+	GraphicsSettings.MenuFrameRateLimit = 60;
+	GraphicsSettings.BackgroundFrameRateLimit = 15;
+
+	// Defaults for this machine once it has been benchmarked
+	if (HardwareBenchmark.IsValid())
+	{
+		GraphicsSettings.FrameRateLimit = HardwareBenchmark.RecommendedFrameRateLimit;
+		GraphicsSettings.QualityPreset = HardwareBenchmark.RecommendedQualityPreset;
+		GraphicsSettings.ResolutionScale = HardwareBenchmark.RecommendedResolutionScale;
+	}
 
 	// Set sensible defaults - Audio (0.0 = muted)
 	AudioSettings.MasterVolume = 1.0f;
@@ -1163,11 +2336,16 @@ void UNohamSettingsSubsystem::LoadDefaultSettings()
 }
 
 FString UNohamSettingsSubsystem::GetSettingsFilePath() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("Config") / TEXT("NohamSettings.bin");
+}
+
+FString UNohamSettingsSubsystem::GetLegacySettingsFilePath() const
 {
 	return FPaths::ProjectSavedDir() / TEXT("Config") / TEXT("NohamSettings.json");
 }
 
 FString UNohamSettingsSubsystem::GetBackupFilePath() const
 {
-	return FPaths::ProjectSavedDir() / TEXT("Config") / TEXT("NohamSettings.backup.json");
+	return FPaths::ProjectSavedDir() / TEXT("Config") / TEXT("NohamSettings.backup.bin");
 }
@@ -189,6 +189,7 @@ void UNohamUIManagerSubsystem::SetInputModeUIOnly(UUserWidget* WidgetToFocus, bo
 	PC->bShowMouseCursor = bShowMouseCursor;
 
 	LogUIAction(TEXT("SetInputMode"), TEXT("UI Only"));
+	SetCurrentInputMode(ENohamUIInputMode::UIOnly);
 }
 
 void UNohamUIManagerSubsystem::SetInputModeGameOnly(bool bHideMouseCursor)
@@ -204,6 +205,7 @@ void UNohamUIManagerSubsystem::SetInputModeGameOnly(bool bHideMouseCursor)
 	PC->bShowMouseCursor = !bHideMouseCursor;
 
 	LogUIAction(TEXT("SetInputMode"), TEXT("Game Only"));
+	SetCurrentInputMode(ENohamUIInputMode::GameOnly);
 }
 
 void UNohamUIManagerSubsystem::SetInputModeGameAndUI(UUserWidget* WidgetToFocus, bool bShowMouseCursor)
@@ -225,6 +227,7 @@ void UNohamUIManagerSubsystem::SetInputModeGameAndUI(UUserWidget* WidgetToFocus,
 	PC->bShowMouseCursor = bShowMouseCursor;
 
 	LogUIAction(TEXT("SetInputMode"), TEXT("Game and UI"));
+	SetCurrentInputMode(ENohamUIInputMode::GameAndUI);
 }
 
 void UNohamUIManagerSubsystem::ShowMainMenu()
@@ -253,6 +256,17 @@ void UNohamUIManagerSubsystem::ReturnToGame()
 	SetInputModeGameOnly(true);
 }
 
+void UNohamUIManagerSubsystem::SetCurrentInputMode(ENohamUIInputMode NewInputMode)
+{
+	if (CurrentInputMode == NewInputMode)
+	{
+		return;
+	}
+
+	CurrentInputMode = NewInputMode;
+	OnUIInputModeChanged.Broadcast(NewInputMode);
+}
+
 APlayerController* UNohamUIManagerSubsystem::GetPlayerController() const
 {
 	UWorld* World = GetWorld();
@@ -5,13 +5,13 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "Logging/LogMacros.h"
+#include "Subsystems/Settings/NohamSettingsSubsystem.h"
 #include "NohamCharacter.generated.h"
 
 class UInputComponent;
 class UCameraComponent;
 class UInputAction;
 class UInputMappingContext;
-class UNohamSettingsSubsystem;
 struct FInputActionValue;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogNohamCharacter, Log, All);
@@ -72,6 +72,7 @@ public:
 protected:
 	// AActor interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	// End of AActor interface
 
@@ -227,10 +228,20 @@ private:
 	void UpdateCameraCollision(float DeltaTime);
 	bool CheckCameraCollision(const FVector& DesiredLocation, FVector& OutSafeLocation);
 
+	// Input settings, cached from OnInputSettingsChanged instead of queried on every Look event
+	float CachedMouseSensitivityX = 1.0f;
+	float CachedMouseSensitivityY = 1.0f;
+	float CachedADSSensitivityMultiplier = 1.0f;
+	bool bCachedInvertMouseY = false;
+
+	UFUNCTION()
+	void HandleInputSettingsChanged(const FNohamInputSettings& OldSettings, const FNohamInputSettings& NewSettings);
+	void CacheInputSettings(const FNohamInputSettings& Settings);
+
 	// Input processing helpers
-	float GetMouseSensitivityX() const;
-	float GetMouseSensitivityY() const;
-	bool ShouldInvertMouseY() const;
+	float GetMouseSensitivityX() const { return CachedMouseSensitivityX; }
+	float GetMouseSensitivityY() const { return CachedMouseSensitivityY; }
+	bool ShouldInvertMouseY() const { return bCachedInvertMouseY; }
 
 	// Movement state update helpers
 	void UpdateCrouchState(float DeltaTime);
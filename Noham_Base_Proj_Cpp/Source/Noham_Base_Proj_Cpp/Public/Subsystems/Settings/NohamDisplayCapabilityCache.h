@@ -0,0 +1,38 @@
+// Copyright Noham Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Subsystems/Settings/NohamSettingsSubsystem.h"
+
+/**
+ * FNohamDisplayCapabilityCache
+ *
+ * Display modes, HDR support and monitors, queried from the OS once on a worker thread and kept until
+ * the owner reports a display change. Asking for the capabilities while a build runs waits for it, so
+ * callers always get the full set instead of a fallback list.
+ *
+ * Owned and driven from the game thread, only the query itself runs off it.
+ */
+class FNohamDisplayCapabilityCache
+{
+public:
+	/** Start a new query, a build still running is dropped */
+	void Rebuild();
+	bool IsBuilding() const { return PendingCapabilities.IsValid(); }
+
+	/** @return true when a build finished and its result became current */
+	bool Poll();
+
+	/** Current capabilities, waits for a running build */
+	const FNohamDisplayCapabilities& Get();
+
+	/** Query everything from the OS and the RHI, safe off the game thread */
+	static FNohamDisplayCapabilities Build();
+
+private:
+	FNohamDisplayCapabilities Capabilities;
+	TFuture<FNohamDisplayCapabilities> PendingCapabilities;
+	int32 NextRevision = 1;
+};
@@ -0,0 +1,51 @@
+// Copyright Noham Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/Settings/NohamSettingsSubsystem.h"
+
+/**
+ * FNohamFrameRatePolicy
+ *
+ * Picks the frame rate cap for what the player is doing instead of the one global limit:
+ * - Background: the window is unfocused or minimized
+ * - Menu: a full-screen menu holds UI only input
+ * - Gameplay: everything else, the player's FrameRateLimit
+ * Background wins over Menu. A state cap never raises the gameplay cap, and leaving a state puts the
+ * gameplay cap back.
+ *
+ * Only sets t.MaxFPS, the saved FrameRateLimit is not touched. Game thread only.
+ */
+class FNohamFrameRatePolicy
+{
+public:
+	struct FCaps
+	{
+		// 0 = unlimited for Gameplay, same as Gameplay for the others
+		int32 Gameplay = 0;
+		int32 Menu = 60;
+		int32 Background = 15;
+	};
+
+	void SetCaps(const FCaps& InCaps);
+	void SetFocused(bool bInFocused);
+	void SetMenuOpen(bool bInMenuOpen);
+
+	ENohamFrameRateState GetState() const;
+	int32 GetActiveLimit() const;
+
+	/**
+	 * Push the active cap to the engine if it changed
+	 * @param bForce - Push it anyway, after something else (ApplyNonResolutionSettings) wrote t.MaxFPS
+	 */
+	void Apply(bool bForce = false);
+
+private:
+	FCaps Caps;
+	bool bFocused = true;
+	bool bMenuOpen = false;
+
+	// Last cap pushed, INDEX_NONE before the first
+	int32 AppliedLimit = INDEX_NONE;
+};
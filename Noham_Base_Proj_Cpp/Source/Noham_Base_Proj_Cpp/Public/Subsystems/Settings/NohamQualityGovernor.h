@@ -0,0 +1,72 @@
+// Copyright Noham Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Scalability.h"
+#include "Subsystems/Settings/NohamSettingsSubsystem.h"
+
+/**
+ * FNohamQualityGovernor
+ *
+ * Frame time driven quality control behind the Adaptive graphics mode of UNohamSettingsSubsystem.
+ * Each tick reads the smoothed GPU, game thread and render thread times and, when the slowest is outside
+ * the band around the target for long enough:
+ * - GPU bound over budget: lowers the screen percentage, then scalability groups once it is at the minimum
+ * - Render thread bound over budget: lowers the groups that cost draw calls (view distance, foliage, shadows)
+ * - Game thread bound over budget: changes nothing, graphics settings don't help; counted in FramesGameThreadBound
+ * - Under budget: restores groups first, then the screen percentage, never above the player's preset
+ *
+ * Works on the live Scalability levels only, nothing it changes is saved. Game thread only.
+ */
+class FNohamQualityGovernor
+{
+public:
+	struct FConfig
+	{
+		float TargetFrameTimeMs = 8.33f;
+		float MinResolutionScale = 50.0f;
+		float MaxResolutionScale = 100.0f;
+	};
+
+	/** Start from the current Scalability levels, which also become the upper limit per group */
+	void Start(const FConfig& InConfig);
+	void Stop();
+	bool IsRunning() const { return bRunning; }
+
+	void Tick(float DeltaTime);
+
+	/** Freeze the current levels, e.g. while a benchmark measures them */
+	void SetLocked(bool bInLocked);
+	bool IsLocked() const { return bLocked; }
+
+	const FNohamAdaptiveQualityStats& GetStats() const { return Stats; }
+	void ResetStats();
+
+private:
+	enum class EBottleneck : uint8
+	{
+		GPU,
+		RenderThread,
+		GameThread
+	};
+
+	void StepDown(EBottleneck Bottleneck);
+	void StepUp();
+	void ApplyLevels();
+	void ResetHysteresis();
+
+	FConfig Config;
+	Scalability::FQualityLevels Levels;
+	Scalability::FQualityLevels MaxLevels;
+
+	bool bRunning = false;
+	bool bLocked = false;
+
+	// Seconds the frame time has been continuously over / under the band, and time left before the next step
+	float OverBudgetTime = 0.0f;
+	float UnderBudgetTime = 0.0f;
+	float Cooldown = 0.0f;
+
+	FNohamAdaptiveQualityStats Stats;
+};
@@ -0,0 +1,53 @@
+// Copyright Noham Studios. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Scalability.h"
+#include "Subsystems/Settings/NohamSettingsSubsystem.h"
+
+/**
+ * FNohamScalabilityProfiler
+ *
+ * Measures the GPU time of every scalability group at every level on whatever the scene currently shows.
+ * Spread over frames instead of blocking: each step switches one group to one level with all other groups
+ * at their current level, skips a few frames for the switch to settle and takes the median GPU time of the
+ * next ones. The original levels are restored when it finishes or is cancelled.
+ *
+ * The switches are visible on screen, run it behind a menu. Game thread only.
+ */
+class FNohamScalabilityProfiler
+{
+public:
+	void Start();
+	void Cancel();
+	bool IsRunning() const { return bRunning; }
+
+	/** @return true on the tick that completed the sweep */
+	bool Tick(float DeltaTime);
+
+	const FNohamScalabilityCostEstimates& GetResults() const { return Results; }
+
+	/** Level of one group in a set of Scalability levels */
+	static int32& GetGroupLevel(Scalability::FQualityLevels& Levels, ENohamScalabilityGroup Group);
+
+private:
+	struct FStep
+	{
+		// INDEX_NONE for the baseline at the original levels
+		int32 GroupIndex = INDEX_NONE;
+		int32 Level = 0;
+	};
+
+	void BeginStep();
+	void FinishStep();
+
+	bool bRunning = false;
+	Scalability::FQualityLevels OriginalLevels;
+	TArray<FStep> Steps;
+	int32 StepIndex = 0;
+	int32 FramesInStep = 0;
+	TArray<float> Samples;
+
+	FNohamScalabilityCostEstimates Results;
+};
@@ -4,8 +4,57 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "TimerManager.h"
+#include "Subsystems/UI/NohamUIManagerSubsystem.h"
 #include "NohamSettingsSubsystem.generated.h"
 
+/**
+ * ENohamSettingsCategory
+ * Settings categories, used as flags for dirty tracking
+ */
+enum class ENohamSettingsCategory : uint8
+{
+	None = 0,
+	Graphics = 1 << 0,
+	Audio = 1 << 1,
+	Input = 1 << 2,
+	All = Graphics | Audio | Input
+};
+ENUM_CLASS_FLAGS(ENohamSettingsCategory);
+
+/**
+ * ENohamScalabilityGroup
+ * Engine scalability groups that can be set individually
+ */
+UENUM(BlueprintType)
+enum class ENohamScalabilityGroup : uint8
+{
+	Shadows,
+	Textures,
+	Effects,
+	PostProcess,
+	Foliage,
+	ViewDistance,
+	AntiAliasing,
+	GlobalIllumination,
+	Reflections,
+	MAX UMETA(Hidden)
+};
+
+/**
+ * ENohamFrameRateState
+ * What the frame rate cap currently follows
+ */
+UENUM(BlueprintType)
+enum class ENohamFrameRateState : uint8
+{
+	Gameplay,
+	Menu,
+	Background
+};
+
 /**
  * FNohamGraphicsSettings
  * Data structure for graphics settings
@@ -29,8 +78,335 @@ struct FNohamGraphicsSettings
 
 	UPROPERTY(BlueprintReadWrite, Category = "Graphics")
 	int32 QualityPreset = 3; // 0=Low, 1=Medium, 2=High, 3=Epic
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics")
+	float ResolutionScale = 100.0f; // Screen percentage, 25 to 100
+
+	// Per group levels, 0=Low to 3=Epic. -1 follows QualityPreset.
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 ShadowQuality = -1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 TextureQuality = -1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 EffectsQuality = -1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 PostProcessQuality = -1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 FoliageQuality = -1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 ViewDistanceQuality = -1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 AntiAliasingQuality = -1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 GlobalIlluminationQuality = -1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Groups")
+	int32 ReflectionQuality = -1;
+
+	// Adaptive mode: the preset and ResolutionScale become upper limits, quality follows TargetFrameTimeMs
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Adaptive")
+	bool bAdaptiveQuality = false;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Adaptive")
+	float TargetFrameTimeMs = 8.33f; // 120 FPS
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|Adaptive")
+	float MinAdaptiveResolutionScale = 50.0f;
+
+	// Caps while a full-screen menu is open and while the window is unfocused or minimized, never above FrameRateLimit.
+	// 0 = same as FrameRateLimit.
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|FrameRate")
+	int32 MenuFrameRateLimit = 60;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Graphics|FrameRate")
+	int32 BackgroundFrameRateLimit = 15;
+};
+
+/**
+ * FNohamAdaptiveQualityStats
+ * Telemetry of the adaptive quality governor since it was started or reset
+ */
+USTRUCT(BlueprintType)
+struct FNohamAdaptiveQualityStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	float CurrentResolutionScale = 100.0f;
+
+	// Scalability groups currently below the preset
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	int32 GroupsReduced = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	float SmoothedGPUTimeMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	float SmoothedGameThreadTimeMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	float SmoothedRenderThreadTimeMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	int32 ResolutionDecreases = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	int32 ResolutionIncreases = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	int32 GroupDecreases = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	int32 GroupIncreases = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	int32 FramesEvaluated = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	int32 FramesOverTarget = 0;
+
+	// Frames over target with the game thread as the slowest, which no graphics setting can fix
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Adaptive")
+	int32 FramesGameThreadBound = 0;
+};
+
+/**
+ * FNohamDisplayMode
+ * One fullscreen mode of the display adapter
+ */
+USTRUCT(BlueprintType)
+struct FNohamDisplayMode
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	FIntPoint Resolution = FIntPoint::ZeroValue;
+
+	// Hz, 0 if the platform does not report it
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	int32 RefreshRate = 0;
+
+	bool operator==(const FNohamDisplayMode& Other) const
+	{
+		return Resolution == Other.Resolution && RefreshRate == Other.RefreshRate;
+	}
+};
+
+/**
+ * FNohamMonitorInfo
+ * A monitor connected to the display adapter
+ */
+USTRUCT(BlueprintType)
+struct FNohamMonitorInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	FString Name;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	FString Id;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	FIntPoint NativeResolution = FIntPoint::ZeroValue;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	FIntPoint MaxResolution = FIntPoint::ZeroValue;
+
+	// Top left corner on the virtual desktop
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	FIntPoint Position = FIntPoint::ZeroValue;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	int32 DPI = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	bool bIsPrimary = false;
+};
+
+/**
+ * FNohamDisplayCapabilities
+ * What the display adapter and its monitors support, cached until the display setup changes
+ */
+USTRUCT(BlueprintType)
+struct FNohamDisplayCapabilities
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	FString AdapterName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	bool bHDRSupported = false;
+
+	// Largest first, one entry per resolution and refresh rate
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	TArray<FNohamDisplayMode> DisplayModes;
+
+	// Distinct resolutions and refresh rates of DisplayModes, largest first
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	TArray<FIntPoint> Resolutions;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	TArray<int32> RefreshRates;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	TArray<FNohamMonitorInfo> Monitors;
+
+	// Increases with every rebuild, 0 until the first one finished
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	int32 Revision = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Display")
+	FDateTime Timestamp;
+
+	bool IsValid() const { return Revision > 0; }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDisplayCapabilitiesChanged, const FNohamDisplayCapabilities&, Capabilities);
+
+/**
+ * FNohamHardwareBenchmark
+ * Result of the synth benchmark and the graphics settings recommended for it
+ */
+USTRUCT(BlueprintType)
+struct FNohamHardwareBenchmark
+{
+	GENERATED_BODY()
+
+	// Performance indices from the engine synth benchmark, 100 is the engine's reference machine. -1 until run.
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Benchmark")
+	float CPUScore = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Benchmark")
+	float GPUScore = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Benchmark")
+	int32 RecommendedQualityPreset = 3;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Benchmark")
+	float RecommendedResolutionScale = 100.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Benchmark")
+	int32 RecommendedFrameRateLimit = 0;
+
+	// CPU, GPU and memory the scores belong to, the benchmark runs again when it changes
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Benchmark")
+	FString HardwareFingerprint;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Benchmark")
+	FDateTime Timestamp;
+
+	bool IsValid() const { return CPUScore > 0.0f && GPUScore > 0.0f; }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHardwareBenchmarkCompleted, const FNohamHardwareBenchmark&, Result);
+
+/**
+ * FNohamScalabilityGroupCost
+ * Measured GPU time of one scalability group per level
+ */
+USTRUCT(BlueprintType)
+struct FNohamScalabilityGroupCost
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Groups")
+	ENohamScalabilityGroup Group = ENohamScalabilityGroup::Shadows;
+
+	// Level the other measurements of this group are relative to
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Groups")
+	int32 BaselineLevel = 0;
+
+	// GPU frame time with this group at each level (index = level) and all others at their baseline, -1 if not measured
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Groups")
+	TArray<float> GPUTimeMs;
+};
+
+/**
+ * FNohamScalabilityCostEstimates
+ * Result of a scalability profiling run on the scene that was showing
+ */
+USTRUCT(BlueprintType)
+struct FNohamScalabilityCostEstimates
+{
+	GENERATED_BODY()
+
+	// GPU frame time with every group at its baseline level, -1 until profiled
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Groups")
+	float BaselineGPUTimeMs = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Groups")
+	float ProfiledResolutionScale = 100.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Groups")
+	TArray<FNohamScalabilityGroupCost> Groups;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics|Groups")
+	FDateTime Timestamp;
+
+	bool IsValid() const { return BaselineGPUTimeMs > 0.0f; }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScalabilityProfilingCompleted, const FNohamScalabilityCostEstimates&, Estimates);
+
+/**
+ * FNohamGraphicsApplyResult
+ * Engine-side work a graphics change actually caused
+ */
+USTRUCT(BlueprintType)
+struct FNohamGraphicsApplyResult
+{
+	GENERATED_BODY()
+
+	// Resolution and/or window mode, applied with a single ApplyResolutionSettings
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bResolutionApplied = false;
+
+	// Scalability, VSync and frame rate limit, applied with a single ApplyNonResolutionSettings
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bScalabilityApplied = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bResolutionChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bWindowModeChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bVSyncChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bFrameRateLimitChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bQualityPresetChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bScalabilityGroupsChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bResolutionScaleChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bAdaptiveQualityChanged = false;
+
+	// Menu or background cap, these only retarget t.MaxFPS
+	UPROPERTY(BlueprintReadOnly, Category = "Graphics")
+	bool bFrameRatePolicyChanged = false;
+
+	bool HasChanges() const { return bResolutionApplied || bScalabilityApplied || bFrameRatePolicyChanged; }
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGraphicsSettingsApplied, const FNohamGraphicsApplyResult&, Result);
+
 /**
  * FNohamAudioDevice
  * Data structure representing an audio output device
@@ -123,6 +499,17 @@ struct FNohamInputSettings
 	float VibrationIntensity = 1.0f;
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGraphicsSettingsChanged, const FNohamGraphicsSettings&, OldSettings, const FNohamGraphicsSettings&, NewSettings);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAudioSettingsChanged, const FNohamAudioSettings&, OldSettings, const FNohamAudioSettings&, NewSettings);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInputSettingsChanged, const FNohamInputSettings&, OldSettings, const FNohamInputSettings&, NewSettings);
+
+class FNohamQualityGovernor;
+class FNohamScalabilityProfiler;
+class FNohamFrameRatePolicy;
+class FNohamDisplayCapabilityCache;
+class UNEONWidget;
+struct FDisplayMetrics;
+
 /**
  * UNohamSettingsSubsystem
  *
@@ -152,11 +539,44 @@ public:
 	FNohamGraphicsSettings GetGraphicsSettings() const { return GraphicsSettings; }
 
 	/**
-	 * Get supported screen resolutions for current display
+	 * Get supported screen resolutions for current display, largest first
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
 	TArray<FIntPoint> GetSupportedResolutions();
 
+	/**
+	 * Get the refresh rates a resolution supports, highest first
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	TArray<int32> GetSupportedRefreshRates(FIntPoint Resolution);
+
+	/**
+	 * Get display modes, HDR support and monitors
+	 * Built on a worker thread at startup and again only when the display setup changes.
+	 * Waits for that build if it has not finished yet.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	FNohamDisplayCapabilities GetDisplayCapabilities();
+
+	/**
+	 * Query the display capabilities again, e.g. after a driver change the OS did not report
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	void RefreshDisplayCapabilities();
+
+	/**
+	 * Push the full display capabilities to NEON pages subscribed to Settings.Display
+	 * Done after every rebuild and whenever a widget subscribes to the topic.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	void PublishDisplayCapabilities();
+
+	/**
+	 * Event broadcast when a display capability build finished
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Noham|Settings|Graphics")
+	FOnDisplayCapabilitiesChanged OnDisplayCapabilitiesChanged;
+
 	/**
 	 * Update graphics settings and apply immediately
 	 * @param NewSettings - New graphics settings to apply
@@ -191,12 +611,165 @@ public:
 	bool SetFrameRateLimit(int32 Limit);
 
 	/**
-	 * Set overall quality preset
+	 * Set the caps used instead of the frame rate limit while a menu is open or the window is in the background
+	 * @param MenuLimit - Cap while UI only input is set, 0 or 10 and up. 0 keeps the frame rate limit.
+	 * @param BackgroundLimit - Cap while the window is unfocused or minimized, 0 or 5 and up. 0 keeps the frame rate limit.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	bool SetFrameRatePolicy(int32 MenuLimit, int32 BackgroundLimit);
+
+	/**
+	 * Get which cap is in effect right now
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	ENohamFrameRateState GetFrameRateState() const;
+
+	/**
+	 * Get the cap in effect right now, 0 = unlimited
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	int32 GetActiveFrameRateLimit() const;
+
+	/**
+	 * Set overall quality preset, clears the per group levels
 	 * @param Preset - 0=Low, 1=Medium, 2=High, 3=Epic
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
 	bool SetQualityPreset(int32 Preset);
 
+	/**
+	 * Set resolution scale (screen percentage, 25 to 100)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	bool SetResolutionScale(float Scale);
+
+	/**
+	 * Set the level of a single scalability group
+	 * @param Level - 0=Low to 3=Epic, -1 to follow the quality preset
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	bool SetScalabilityGroupLevel(ENohamScalabilityGroup Group, int32 Level);
+
+	/**
+	 * Get the level a group ends up at in the given settings, resolving -1 to the preset
+	 */
+	UFUNCTION(BlueprintPure, Category = "Noham|Settings|Graphics")
+	static int32 GetEffectiveGroupLevel(const FNohamGraphicsSettings& Settings, ENohamScalabilityGroup Group);
+
+	/**
+	 * Measure the GPU cost of every group and level on the current scene, spread over the next frames
+	 * Quality visibly changes while it runs, start it behind the settings menu. Applying graphics settings cancels it.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	bool StartScalabilityProfiling();
+
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	void CancelScalabilityProfiling();
+
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	bool IsProfilingScalability() const;
+
+	/**
+	 * Get the measurements of the last profiling run
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	FNohamScalabilityCostEstimates GetScalabilityCostEstimates() const { return ScalabilityCostEstimates; }
+
+	/**
+	 * Estimate the GPU frame time of candidate settings from the last profiling run, before applying them
+	 * Group costs are added up and scaled by the pixel count of the resolution scale, so it is an estimate.
+	 * @return Estimated GPU ms, or -1 if nothing has been profiled yet
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	float EstimateGPUFrameTimeMs(const FNohamGraphicsSettings& Candidate) const;
+
+	/**
+	 * Event broadcast when a scalability profiling run finished
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Noham|Settings|Graphics")
+	FOnScalabilityProfilingCompleted OnScalabilityProfilingCompleted;
+
+	/**
+	 * Switch between the static preset and the adaptive quality mode
+	 * @param bEnabled - Let the governor lower and raise quality below the preset to hold the target
+	 * @param TargetFrameTimeMs - Frame time to hold, 4 to 50 ms
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	bool SetAdaptiveQuality(bool bEnabled, float TargetFrameTimeMs = 8.33f);
+
+	/**
+	 * Freeze the adaptive quality governor at its current levels, e.g. during benchmarks or captures
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	void SetAdaptiveQualityLocked(bool bLocked);
+
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	bool IsAdaptiveQualityLocked() const;
+
+	/**
+	 * Get how often and how far the adaptive quality governor adjusted
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	FNohamAdaptiveQualityStats GetAdaptiveQualityStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	void ResetAdaptiveQualityStats();
+
+	/**
+	 * Run the engine CPU/GPU synth benchmark and derive recommended graphics settings
+	 * Blocks the game thread for a moment. Runs by itself on first launch and when the hardware changes.
+	 * @param bApplyRecommended - Apply the recommended preset, resolution scale and frame rate limit
+	 * @return The new result, or the previous one if the benchmark failed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	FNohamHardwareBenchmark RunHardwareBenchmark(bool bApplyRecommended);
+
+	/**
+	 * Get the last benchmark result, for showing the scores in the settings UI
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	FNohamHardwareBenchmark GetHardwareBenchmark() const { return HardwareBenchmark; }
+
+	/**
+	 * Event broadcast when a hardware benchmark finished
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Noham|Settings|Graphics")
+	FOnHardwareBenchmarkCompleted OnHardwareBenchmarkCompleted;
+
+	/**
+	 * Start batching graphics changes
+	 * Setters and UpdateGraphicsSettings only edit the pending state until the matching commit.
+	 * Transactions nest, only the outermost commit applies.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	void BeginGraphicsTransaction();
+
+	/**
+	 * Apply the pending graphics state in one pass
+	 * Diffs it against what is applied: at most one resolution/window mode change and one scalability apply
+	 * @return What was reapplied, empty for an inner commit
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	FNohamGraphicsApplyResult CommitGraphicsTransaction();
+
+	/**
+	 * Drop the pending graphics state, including all nested transactions
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	void CancelGraphicsTransaction();
+
+	/**
+	 * Check if a graphics transaction is open
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings|Graphics")
+	bool IsInGraphicsTransaction() const { return GraphicsTransactionDepth > 0; }
+
+	/**
+	 * Event broadcast after graphics settings reached the engine, with what was reapplied
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Noham|Settings|Graphics")
+	FOnGraphicsSettingsApplied OnGraphicsSettingsApplied;
+
 	// ======== Audio Settings ========
 
 	/**
@@ -358,13 +931,27 @@ public:
 	// ======== Settings Persistence ========
 
 	/**
-	 * Save all settings to persistent storage
+	 * Save all settings to persistent storage now, bypassing the debounce
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Noham|Settings")
 	bool SaveSettings();
 
+	/**
+	 * Write pending changes now instead of waiting for the debounce
+	 * Serialization and file write run on a background task
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings")
+	void FlushSettings();
+
+	/**
+	 * Check if there are changes that have not been written yet
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Noham|Settings")
+	bool HasUnsavedChanges() const { return DirtyCategories != ENohamSettingsCategory::None; }
+
 	/**
 	 * Load settings from persistent storage
+	 * Migrates the old JSON settings file if no binary settings exist yet
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Noham|Settings")
 	bool LoadSettings();
@@ -397,7 +984,7 @@ public:
 	bool HasBackup() const;
 
 	/**
-	 * Export settings to a file
+	 * Export settings to a JSON file
 	 * @param FilePath - Path to export file
 	 * @return true if export was successful
 	 */
@@ -405,7 +992,7 @@ public:
 	bool ExportSettings(const FString& FilePath);
 
 	/**
-	 * Import settings from a file
+	 * Import settings from a JSON file
 	 * @param FilePath - Path to import file
 	 * @return true if import was successful
 	 */
@@ -434,20 +1021,107 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Noham|Settings")
 	bool ValidateGraphicsSettings(const FNohamGraphicsSettings& NewSettings);
 
+	// ======== Change Events ========
+	// Fired once per committed change (a setter, a graphics transaction, load, reset, restore or import),
+	// only for categories whose values actually differ. Consumers should cache what they need from NewSettings
+	// instead of polling the getters. NEON pages get the changed fields pushed on the Settings.Graphics,
+	// Settings.Audio and Settings.Input topics.
+
+	UPROPERTY(BlueprintAssignable, Category = "Noham|Settings|Graphics")
+	FOnGraphicsSettingsChanged OnGraphicsSettingsChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "Noham|Settings|Audio")
+	FOnAudioSettingsChanged OnAudioSettingsChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "Noham|Settings|Input")
+	FOnInputSettingsChanged OnInputSettingsChanged;
+
 private:
 	// Current settings state
 	FNohamGraphicsSettings GraphicsSettings;
 	FNohamAudioSettings AudioSettings;
 	FNohamInputSettings InputSettings;
 
+	// Persisted with the settings, machine specific so not part of export/import
+	FNohamHardwareBenchmark HardwareBenchmark;
+	void RunFirstLaunchBenchmark();
+
+	// Set when LoadSettings found saved graphics settings (binary or legacy JSON). The startup benchmark then only
+	// stores its scores, the recommendations are applied on a true first run only.
+	bool bLoadedGraphicsSettings = false;
+
+	// Adaptive quality, ticked on the core ticker while the mode is on
+	TSharedPtr<FNohamQualityGovernor> QualityGovernor;
+	FTSTicker::FDelegateHandle QualityGovernorTicker;
+	void UpdateQualityGovernor(bool bRestart);
+	bool TickQualityGovernor(float DeltaTime);
+
+	// Scalability profiling, ticked on the core ticker while it runs
+	TSharedPtr<FNohamScalabilityProfiler> ScalabilityProfiler;
+	FTSTicker::FDelegateHandle ScalabilityProfilerTicker;
+	FNohamScalabilityCostEstimates ScalabilityCostEstimates;
+	bool bGovernorLockedBeforeProfiling = false;
+	bool TickScalabilityProfiler(float DeltaTime);
+	void StopScalabilityProfilerTicker();
+
+	// Frame rate caps per state, switched by window activation and the UI manager's input mode
+	TSharedPtr<FNohamFrameRatePolicy> FrameRatePolicy;
+	FDelegateHandle ActivationStateChangedHandle;
+	FDelegateHandle EnterBackgroundHandle;
+	FDelegateHandle EnterForegroundHandle;
+	TWeakObjectPtr<UNohamUIManagerSubsystem> UIManager;
+	void UpdateFrameRatePolicy(bool bForce);
+	void HandleApplicationActivationChanged(bool bIsActive);
+
+	UFUNCTION()
+	void HandleUIInputModeChanged(ENohamUIInputMode NewInputMode);
+
+	// Display capabilities, rebuilt on display changes and polled on the core ticker while building
+	TSharedPtr<FNohamDisplayCapabilityCache> DisplayCapabilityCache;
+	FTSTicker::FDelegateHandle DisplayCapabilityTicker;
+	FDelegateHandle DisplayMetricsChangedHandle;
+	int32 BroadcastDisplayRevision = 0;
+	FDelegateHandle TopicSubscribedHandle;
+	void HandleDisplayMetricsChanged(const FDisplayMetrics& DisplayMetrics);
+	void HandleTopicSubscribed(FName Topic, UNEONWidget* Widget);
+	bool TickDisplayCapabilities(float DeltaTime);
+
+	// Graphics state as last pushed to GameUserSettings, the diff base for ApplyGraphicsSettings
+	FNohamGraphicsSettings AppliedGraphicsSettings;
+	bool bHasAppliedGraphics = false;
+
+	// Open graphics transaction
+	FNohamGraphicsSettings PendingGraphicsSettings;
+	int32 GraphicsTransactionDepth = 0;
+
 	// Internal helper functions
-	void ApplyGraphicsSettings();
+	FNohamGraphicsApplyResult ApplyGraphicsSettings();
 	void ApplyAudioSettings();
 	void ApplyInputSettings();
 	void LoadDefaultSettings();
 	FString GetSettingsFilePath() const;
+	FString GetLegacySettingsFilePath() const;
 	FString GetBackupFilePath() const;
 
+	// Reads the JSON settings file used before the binary store
+	bool LoadLegacySettings(const FString& FilePath);
+
+	// Last state reported through the change events, the diff base for BroadcastSettingsChanges
+	FNohamGraphicsSettings NotifiedGraphicsSettings;
+	FNohamAudioSettings NotifiedAudioSettings;
+	FNohamInputSettings NotifiedInputSettings;
+	void BroadcastSettingsChanges();
+
+	// Deferred persistence: setters only mark their category dirty,
+	// FlushSettings runs SaveDebounceSeconds after the last change
+	void MarkSettingsDirty(ENohamSettingsCategory Category);
+	void WaitForPendingSave();
+
+	ENohamSettingsCategory DirtyCategories = ENohamSettingsCategory::None;
+	FTimerHandle SaveDebounceTimer;
+	TFuture<bool> PendingSave;
+	float SaveDebounceSeconds = 0.5f;
+
 	// Settings backup state
 	FNohamGraphicsSettings BackupGraphicsSettings;
 	FNohamAudioSettings BackupAudioSettings;
@@ -7,6 +7,19 @@
 #include "Blueprint/UserWidget.h"
 #include "NohamUIManagerSubsystem.generated.h"
 
+/**
+ * Input mode last set through the UI manager
+ */
+UENUM(BlueprintType)
+enum class ENohamUIInputMode : uint8
+{
+	GameOnly,
+	GameAndUI,
+	UIOnly
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUIInputModeChanged, ENohamUIInputMode, NewInputMode);
+
 /**
  * UNohamUIManagerSubsystem
  *
@@ -114,6 +127,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UI Manager")
 	void ReturnToGame();
 
+	/**
+	 * Get the input mode last set through the UI manager
+	 */
+	UFUNCTION(BlueprintPure, Category = "UI Manager")
+	ENohamUIInputMode GetCurrentInputMode() const { return CurrentInputMode; }
+
+	/**
+	 * Broadcast when one of the SetInputMode functions switches to a different mode
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "UI Manager")
+	FOnUIInputModeChanged OnUIInputModeChanged;
+
 private:
 	/**
 	 * Widget class registry
@@ -136,6 +161,8 @@ private:
 	UPROPERTY()
 	TSet<FString> VisibleWidgets;
 
+	ENohamUIInputMode CurrentInputMode = ENohamUIInputMode::GameOnly;
+
 	/**
 	 * Initialize widget class registry
 	 * Loads all widget blueprint classes
@@ -152,6 +179,11 @@ private:
 	 */
 	APlayerController* GetPlayerController() const;
 
+	/**
+	 * Record the new input mode and broadcast it if it changed
+	 */
+	void SetCurrentInputMode(ENohamUIInputMode NewInputMode);
+
 	/**
 	 * Log UI manager action
 	 */
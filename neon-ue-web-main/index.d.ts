@@ -4,13 +4,18 @@ declare namespace NEON {
   function invokeUnrealEvent(delegate: string, data?: object): void;
   function invokeUnrealFunction(delegate: string, data?: object): Promise<any>;
   const invokeUnreal: typeof invokeUnrealEvent;
+  function invokeUnrealFunctionById(id: number, data?: object): Promise<any>;
+  function invokeUnrealEventById(id: number, data?: object): Promise<void>;
 
   function onInvoke(delegate: string, callback: (data: any) => void): void;
+  function subscribe(topic: string, callback: (data: any) => void): void;
+  function unsubscribe(topic: string): void;
 }
 
 interface Window {
   cefQuery: (query: any) => void;
   NEON_Bridge_Web_Invoke: (method: string, data: any) => void;
+  NEON_Bridge_Latency_Enable: (enabled: boolean) => void;
 }
 
 export default NEON;
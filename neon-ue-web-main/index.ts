@@ -9,10 +9,29 @@ namespace NEON {
     return NEON_Bridge_Unreal.invokeUnrealFunction(delegate, data);
   }
 
+  // Calls by binding id, used by the generated neon-bindings (-run=NEONBindings)
+  export function invokeUnrealFunctionById(id: number, data: object = {}): Promise<any> {
+    return NEON_Bridge_Unreal.invokeUnrealById('function', id, data);
+  }
+
+  export function invokeUnrealEventById(id: number, data: object = {}): Promise<void> {
+    return NEON_Bridge_Unreal.invokeUnrealById('event', id, data);
+  }
+
   export function onInvoke(delegate: string, callback: (data: any) => void) {
     NEON_Bridge_Web.registerCallback(delegate, callback);
   }
 
+  // Subscribes the widget showing this page to a topic published from Unreal (FNEONBroadcast)
+  export function subscribe(topic: string, callback: (data: any) => void) {
+    NEON_Bridge_Web.registerCallback(topic, callback);
+    window.cefQuery?.({ request: JSON.stringify({ type: 'subscribe', topic }) });
+  }
+
+  export function unsubscribe(topic: string) {
+    window.cefQuery?.({ request: JSON.stringify({ type: 'unsubscribe', topic }) });
+  }
+
   export function invoke(delegate: string, data: any) {
     NEON_Bridge_Web.invoke(delegate, data);
   }
@@ -88,6 +107,7 @@ class NEON_Bridge_Unreal {
         Log.error('NEON.invokeUnrealFunction failed: cefQuery is not defined');
         return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
       }
+      const start = performance.now();
       window.cefQuery({
         request: JSON.stringify({
           type: 'function',
@@ -95,6 +115,7 @@ class NEON_Bridge_Unreal {
           parameters: data
         }),
         onSuccess: function (response) {
+          NEON_Bridge_Timing.record(start);
           Log.info(`NEON.invokeUnrealFunction[${delegate}] succeeded: ${response}`);
           try {
             const result = JSON.parse(response);
@@ -105,6 +126,7 @@ class NEON_Bridge_Unreal {
           }
         },
         onFailure: function (errorCode, errorMessage) {
+          NEON_Bridge_Timing.record(start);
           Log.error(`NEON.invokeUnrealFunction[${delegate}] failed: ${errorCode} - ${errorMessage}`);
           reject({ errorCode, errorMessage });
         }
@@ -125,6 +147,7 @@ class NEON_Bridge_Unreal {
         Log.error('NEON.invokeUnrealFunction failed: cefQuery is not defined');
         return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
       }
+      const start = performance.now();
       window.cefQuery({
         request: JSON.stringify({
           type: 'event',
@@ -132,20 +155,120 @@ class NEON_Bridge_Unreal {
           parameters: data
         }),
         onSuccess: function (response) {
+          NEON_Bridge_Timing.record(start);
           Log.info(`NEON.invokeUnrealEvent[${delegate}] succeeded.`);
           resolve(null);
         },
         onFailure: function (errorCode, errorMessage) {
+          NEON_Bridge_Timing.record(start);
           Log.error(`NEON.invokeUnrealEvent[${delegate}] failed: ${errorCode} - ${errorMessage}`);
           reject({ errorCode, errorMessage });
         }
       });
     });
   }
+
+  static invokeUnrealById(type: 'function' | 'event', id: number, data: any): Promise<any> {
+    Log.info(`NEON.invokeUnrealById[${type} ${id}]`, data);
+
+    return new Promise<any>((resolve, reject) => {
+      if (!window.cefQuery) {
+        Log.error('NEON.invokeUnrealById failed: cefQuery is not defined');
+        return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
+      }
+      const start = performance.now();
+      window.cefQuery({
+        request: JSON.stringify({
+          type,
+          id,
+          parameters: data
+        }),
+        onSuccess: function (response) {
+          NEON_Bridge_Timing.record(start);
+          Log.info(`NEON.invokeUnrealById[${type} ${id}] succeeded: ${response}`);
+          if (type === 'event' || !response) {
+            resolve(null);
+            return;
+          }
+          try {
+            resolve(JSON.parse(response));
+          } catch (e) {
+            Log.error(`NEON.invokeUnrealById[${type} ${id}] failed to parse response: ${response}`);
+            reject({ errorCode: 102, errorMessage: 'Failed to parse response' })
+          }
+        },
+        onFailure: function (errorCode, errorMessage) {
+          NEON_Bridge_Timing.record(start);
+          Log.error(`NEON.invokeUnrealById[${type} ${id}] failed: ${errorCode} - ${errorMessage}`);
+          reject({ errorCode, errorMessage });
+        }
+      });
+    });
+  }
+}
+
+// Round trip timing of bridge queries. Only the page sees both ends of a cefQuery, so it measures them
+// and reports to Unreal (UNEONWidget::GetQueryRoundTripMs) in one query per second instead of one per call.
+class NEON_Bridge_Timing {
+  private static count = 0;
+  private static totalMs = 0;
+  private static maxMs = 0;
+  private static scheduled = false;
+
+  static record(start: number) {
+    const elapsed = performance.now() - start;
+    NEON_Bridge_Timing.count++;
+    NEON_Bridge_Timing.totalMs += elapsed;
+    NEON_Bridge_Timing.maxMs = Math.max(NEON_Bridge_Timing.maxMs, elapsed);
+    if (!NEON_Bridge_Timing.scheduled) {
+      NEON_Bridge_Timing.scheduled = true;
+      setTimeout(NEON_Bridge_Timing.report, 1000);
+    }
+  }
+
+  private static report() {
+    const { count, totalMs, maxMs } = NEON_Bridge_Timing;
+    NEON_Bridge_Timing.scheduled = false;
+    NEON_Bridge_Timing.count = 0;
+    NEON_Bridge_Timing.totalMs = 0;
+    NEON_Bridge_Timing.maxMs = 0;
+    window.cefQuery?.({ request: JSON.stringify({ type: 'timing', count, totalMs, maxMs }) });
+  }
+}
+
+// Latency probe: echoes every pointerdown/keydown back to Unreal in the frame that reacts to it.
+// Enabled by Unreal (UNEONWidget::_MeasureInputLatency) after the page has loaded.
+class NEON_Bridge_Latency {
+  private static sequence = 0;
+  private static enabled = false;
+
+  static enable(enabled: boolean) {
+    if (enabled === NEON_Bridge_Latency.enabled)
+      return;
+    NEON_Bridge_Latency.enabled = enabled;
+    NEON_Bridge_Latency.sequence = 0;
+
+    if (enabled) {
+      window.addEventListener('pointerdown', NEON_Bridge_Latency.onInput, true);
+      window.addEventListener('keydown', NEON_Bridge_Latency.onInput, true);
+    } else {
+      window.removeEventListener('pointerdown', NEON_Bridge_Latency.onInput, true);
+      window.removeEventListener('keydown', NEON_Bridge_Latency.onInput, true);
+    }
+    Log.info('NEON latency probe', enabled ? 'enabled' : 'disabled');
+  }
+
+  private static onInput() {
+    const sequence = ++NEON_Bridge_Latency.sequence;
+    requestAnimationFrame(() => {
+      window.cefQuery?.({ request: JSON.stringify({ type: 'latency', sequence }) });
+    });
+  }
 }
 
 // Define the NEON Bridge to be called from Unreal
 window.NEON_Bridge_Web_Invoke = NEON.invoke;
+window.NEON_Bridge_Latency_Enable = NEON_Bridge_Latency.enable;
 
 
 export default NEON;
\ No newline at end of file
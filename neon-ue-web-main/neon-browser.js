@@ -17,10 +17,35 @@ var NEON = (function() {
     return NEON_Bridge_Unreal.invokeUnrealFunction(delegate, data);
   };
 
+  // Calls by binding id, used by the generated neon-bindings (-run=NEONBindings)
+  api.invokeUnrealFunctionById = function(id, data) {
+    data = data || {};
+    return NEON_Bridge_Unreal.invokeUnrealById('function', id, data);
+  };
+
+  api.invokeUnrealEventById = function(id, data) {
+    data = data || {};
+    return NEON_Bridge_Unreal.invokeUnrealById('event', id, data);
+  };
+
   api.onInvoke = function(delegate, callback) {
     NEON_Bridge_Web.registerCallback(delegate, callback);
   };
 
+  // Subscribes the widget showing this page to a topic published from Unreal (FNEONBroadcast)
+  api.subscribe = function(topic, callback) {
+    NEON_Bridge_Web.registerCallback(topic, callback);
+    if (window.cefQuery) {
+      window.cefQuery({ request: JSON.stringify({ type: 'subscribe', topic: topic }) });
+    }
+  };
+
+  api.unsubscribe = function(topic) {
+    if (window.cefQuery) {
+      window.cefQuery({ request: JSON.stringify({ type: 'unsubscribe', topic: topic }) });
+    }
+  };
+
   api.invoke = function(delegate, data) {
     NEON_Bridge_Web.invoke(delegate, data);
   };
@@ -103,6 +128,7 @@ var NEON_Bridge_Unreal = (function() {
           Log.error('NEON.invokeUnrealFunction failed: cefQuery is not defined');
           return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
         }
+        var start = performance.now();
         window.cefQuery({
           request: JSON.stringify({
             type: 'function',
@@ -110,6 +136,7 @@ var NEON_Bridge_Unreal = (function() {
             parameters: data
           }),
           onSuccess: function(response) {
+            NEON_Bridge_Timing.record(start);
             Log.info('NEON.invokeUnrealFunction[' + delegate + '] succeeded: ' + response);
             try {
               var result = JSON.parse(response);
@@ -120,6 +147,7 @@ var NEON_Bridge_Unreal = (function() {
             }
           },
           onFailure: function(errorCode, errorMessage) {
+            NEON_Bridge_Timing.record(start);
             Log.error('NEON.invokeUnrealFunction[' + delegate + '] failed: ' + errorCode + ' - ' + errorMessage);
             reject({ errorCode: errorCode, errorMessage: errorMessage });
           }
@@ -142,6 +170,7 @@ var NEON_Bridge_Unreal = (function() {
           Log.error('NEON.invokeUnrealFunction failed: cefQuery is not defined');
           return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
         }
+        var start = performance.now();
         window.cefQuery({
           request: JSON.stringify({
             type: 'event',
@@ -149,21 +178,126 @@ var NEON_Bridge_Unreal = (function() {
             parameters: data
           }),
           onSuccess: function(response) {
+            NEON_Bridge_Timing.record(start);
             Log.info('NEON.invokeUnrealEvent[' + delegate + '] succeeded.');
             resolve(null);
           },
           onFailure: function(errorCode, errorMessage) {
+            NEON_Bridge_Timing.record(start);
             Log.error('NEON.invokeUnrealEvent[' + delegate + '] failed: ' + errorCode + ' - ' + errorMessage);
             reject({ errorCode: errorCode, errorMessage: errorMessage });
           }
         });
       });
+    },
+
+    invokeUnrealById: function(type, id, data) {
+      Log.info('NEON.invokeUnrealById[' + type + ' ' + id + ']', data);
+
+      return new Promise(function(resolve, reject) {
+        if (!window.cefQuery) {
+          Log.error('NEON.invokeUnrealById failed: cefQuery is not defined');
+          return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
+        }
+        var start = performance.now();
+        window.cefQuery({
+          request: JSON.stringify({
+            type: type,
+            id: id,
+            parameters: data
+          }),
+          onSuccess: function(response) {
+            NEON_Bridge_Timing.record(start);
+            Log.info('NEON.invokeUnrealById[' + type + ' ' + id + '] succeeded: ' + response);
+            if (type === 'event' || !response) {
+              resolve(null);
+              return;
+            }
+            try {
+              resolve(JSON.parse(response));
+            } catch (e) {
+              Log.error('NEON.invokeUnrealById[' + type + ' ' + id + '] failed to parse response: ' + response);
+              reject({ errorCode: 102, errorMessage: 'Failed to parse response' });
+            }
+          },
+          onFailure: function(errorCode, errorMessage) {
+            NEON_Bridge_Timing.record(start);
+            Log.error('NEON.invokeUnrealById[' + type + ' ' + id + '] failed: ' + errorCode + ' - ' + errorMessage);
+            reject({ errorCode: errorCode, errorMessage: errorMessage });
+          }
+        });
+      });
+    }
+  };
+})();
+
+// Round trip timing of bridge queries. Only the page sees both ends of a cefQuery, so it measures them
+// and reports to Unreal (UNEONWidget::GetQueryRoundTripMs) in one query per second instead of one per call.
+var NEON_Bridge_Timing = (function() {
+  var count = 0;
+  var totalMs = 0;
+  var maxMs = 0;
+  var scheduled = false;
+
+  function report() {
+    var request = JSON.stringify({ type: 'timing', count: count, totalMs: totalMs, maxMs: maxMs });
+    scheduled = false;
+    count = 0;
+    totalMs = 0;
+    maxMs = 0;
+    if (window.cefQuery) {
+      window.cefQuery({ request: request });
+    }
+  }
+
+  return {
+    record: function(start) {
+      var elapsed = performance.now() - start;
+      count++;
+      totalMs += elapsed;
+      maxMs = Math.max(maxMs, elapsed);
+      if (!scheduled) {
+        scheduled = true;
+        setTimeout(report, 1000);
+      }
+    }
+  };
+})();
+
+// Latency probe: echoes every pointerdown/keydown back to Unreal in the frame that reacts to it.
+// Enabled by Unreal (UNEONWidget::_MeasureInputLatency) after the page has loaded.
+var NEON_Bridge_Latency = (function() {
+  var sequence = 0;
+  var enabled = false;
+
+  function onInput() {
+    var current = ++sequence;
+    requestAnimationFrame(function() {
+      if (window.cefQuery) {
+        window.cefQuery({ request: JSON.stringify({ type: 'latency', sequence: current }) });
+      }
+    });
+  }
+
+  return {
+    enable: function(enable) {
+      if (enable === enabled) return;
+      enabled = enable;
+      sequence = 0;
+      if (enable) {
+        window.addEventListener('pointerdown', onInput, true);
+        window.addEventListener('keydown', onInput, true);
+      } else {
+        window.removeEventListener('pointerdown', onInput, true);
+        window.removeEventListener('keydown', onInput, true);
+      }
     }
   };
 })();
 
 // Define the NEON Bridge to be called from Unreal
 window.NEON_Bridge_Web_Invoke = NEON.invoke;
+window.NEON_Bridge_Latency_Enable = NEON_Bridge_Latency.enable;
 
 // Log that NEON is loaded
 console.log('[NEON] Library loaded and attached to window');
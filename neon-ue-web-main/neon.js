@@ -25,10 +25,35 @@ define("index", ["require", "exports"], function (require, exports) {
             return NEON_Bridge_Unreal.invokeUnrealFunction(delegate, data);
         }
         NEON.invokeUnrealFunction = invokeUnrealFunction;
+        // Calls by binding id, used by the generated neon-bindings (-run=NEONBindings)
+        function invokeUnrealFunctionById(id, data) {
+            if (data === void 0) { data = {}; }
+            return NEON_Bridge_Unreal.invokeUnrealById('function', id, data);
+        }
+        NEON.invokeUnrealFunctionById = invokeUnrealFunctionById;
+        function invokeUnrealEventById(id, data) {
+            if (data === void 0) { data = {}; }
+            return NEON_Bridge_Unreal.invokeUnrealById('event', id, data);
+        }
+        NEON.invokeUnrealEventById = invokeUnrealEventById;
         function onInvoke(delegate, callback) {
             NEON_Bridge_Web.registerCallback(delegate, callback);
         }
         NEON.onInvoke = onInvoke;
+        // Subscribes the widget showing this page to a topic published from Unreal (FNEONBroadcast)
+        function subscribe(topic, callback) {
+            NEON_Bridge_Web.registerCallback(topic, callback);
+            if (window.cefQuery) {
+                window.cefQuery({ request: JSON.stringify({ type: 'subscribe', topic: topic }) });
+            }
+        }
+        NEON.subscribe = subscribe;
+        function unsubscribe(topic) {
+            if (window.cefQuery) {
+                window.cefQuery({ request: JSON.stringify({ type: 'unsubscribe', topic: topic }) });
+            }
+        }
+        NEON.unsubscribe = unsubscribe;
         function invoke(delegate, data) {
             NEON_Bridge_Web.invoke(delegate, data);
         }
@@ -110,6 +135,7 @@ define("index", ["require", "exports"], function (require, exports) {
                     Log.error('NEON.invokeUnrealFunction failed: cefQuery is not defined');
                     return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
                 }
+                var start = performance.now();
                 window.cefQuery({
                     request: JSON.stringify({
                         type: 'function',
@@ -117,6 +143,7 @@ define("index", ["require", "exports"], function (require, exports) {
                         parameters: data
                     }),
                     onSuccess: function (response) {
+                        NEON_Bridge_Timing.record(start);
                         Log.info("NEON.invokeUnrealFunction[".concat(delegate, "] succeeded: ").concat(response));
                         try {
                             var result = JSON.parse(response);
@@ -128,6 +155,7 @@ define("index", ["require", "exports"], function (require, exports) {
                         }
                     },
                     onFailure: function (errorCode, errorMessage) {
+                        NEON_Bridge_Timing.record(start);
                         Log.error("NEON.invokeUnrealFunction[".concat(delegate, "] failed: ").concat(errorCode, " - ").concat(errorMessage));
                         reject({ errorCode: errorCode, errorMessage: errorMessage });
                     }
@@ -147,6 +175,7 @@ define("index", ["require", "exports"], function (require, exports) {
                     Log.error('NEON.invokeUnrealFunction failed: cefQuery is not defined');
                     return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
                 }
+                var start = performance.now();
                 window.cefQuery({
                     request: JSON.stringify({
                         type: 'event',
@@ -154,19 +183,120 @@ define("index", ["require", "exports"], function (require, exports) {
                         parameters: data
                     }),
                     onSuccess: function (response) {
+                        NEON_Bridge_Timing.record(start);
                         Log.info("NEON.invokeUnrealEvent[".concat(delegate, "] succeeded."));
                         resolve(null);
                     },
                     onFailure: function (errorCode, errorMessage) {
+                        NEON_Bridge_Timing.record(start);
                         Log.error("NEON.invokeUnrealEvent[".concat(delegate, "] failed: ").concat(errorCode, " - ").concat(errorMessage));
                         reject({ errorCode: errorCode, errorMessage: errorMessage });
                     }
                 });
             });
         };
+        NEON_Bridge_Unreal.invokeUnrealById = function (type, id, data) {
+            Log.info("NEON.invokeUnrealById[".concat(type, " ").concat(id, "]"), data);
+            return new Promise(function (resolve, reject) {
+                if (!window.cefQuery) {
+                    Log.error('NEON.invokeUnrealById failed: cefQuery is not defined');
+                    return reject({ errorCode: 103, errorMessage: 'cefQuery is not defined' });
+                }
+                var start = performance.now();
+                window.cefQuery({
+                    request: JSON.stringify({
+                        type: type,
+                        id: id,
+                        parameters: data
+                    }),
+                    onSuccess: function (response) {
+                        NEON_Bridge_Timing.record(start);
+                        Log.info("NEON.invokeUnrealById[".concat(type, " ").concat(id, "] succeeded: ").concat(response));
+                        if (type === 'event' || !response) {
+                            resolve(null);
+                            return;
+                        }
+                        try {
+                            resolve(JSON.parse(response));
+                        }
+                        catch (e) {
+                            Log.error("NEON.invokeUnrealById[".concat(type, " ").concat(id, "] failed to parse response: ").concat(response));
+                            reject({ errorCode: 102, errorMessage: 'Failed to parse response' });
+                        }
+                    },
+                    onFailure: function (errorCode, errorMessage) {
+                        NEON_Bridge_Timing.record(start);
+                        Log.error("NEON.invokeUnrealById[".concat(type, " ").concat(id, "] failed: ").concat(errorCode, " - ").concat(errorMessage));
+                        reject({ errorCode: errorCode, errorMessage: errorMessage });
+                    }
+                });
+            });
+        };
         return NEON_Bridge_Unreal;
     }());
+    // Round trip timing of bridge queries. Only the page sees both ends of a cefQuery, so it measures them
+    // and reports to Unreal (UNEONWidget::GetQueryRoundTripMs) in one query per second instead of one per call.
+    var NEON_Bridge_Timing = /** @class */ (function () {
+        function NEON_Bridge_Timing() {
+        }
+        NEON_Bridge_Timing.record = function (start) {
+            var elapsed = performance.now() - start;
+            NEON_Bridge_Timing.count++;
+            NEON_Bridge_Timing.totalMs += elapsed;
+            NEON_Bridge_Timing.maxMs = Math.max(NEON_Bridge_Timing.maxMs, elapsed);
+            if (!NEON_Bridge_Timing.scheduled) {
+                NEON_Bridge_Timing.scheduled = true;
+                setTimeout(NEON_Bridge_Timing.report, 1000);
+            }
+        };
+        NEON_Bridge_Timing.report = function () {
+            var _a;
+            var count = NEON_Bridge_Timing.count, totalMs = NEON_Bridge_Timing.totalMs, maxMs = NEON_Bridge_Timing.maxMs;
+            NEON_Bridge_Timing.scheduled = false;
+            NEON_Bridge_Timing.count = 0;
+            NEON_Bridge_Timing.totalMs = 0;
+            NEON_Bridge_Timing.maxMs = 0;
+            (_a = window.cefQuery) === null || _a === void 0 ? void 0 : _a.call(window, { request: JSON.stringify({ type: 'timing', count: count, totalMs: totalMs, maxMs: maxMs }) });
+        };
+        NEON_Bridge_Timing.count = 0;
+        NEON_Bridge_Timing.totalMs = 0;
+        NEON_Bridge_Timing.maxMs = 0;
+        NEON_Bridge_Timing.scheduled = false;
+        return NEON_Bridge_Timing;
+    }());
+    // Latency probe: echoes every pointerdown/keydown back to Unreal in the frame that reacts to it.
+    // Enabled by Unreal (UNEONWidget::_MeasureInputLatency) after the page has loaded.
+    var NEON_Bridge_Latency = /** @class */ (function () {
+        function NEON_Bridge_Latency() {
+        }
+        NEON_Bridge_Latency.enable = function (enabled) {
+            if (enabled === NEON_Bridge_Latency.enabled)
+                return;
+            NEON_Bridge_Latency.enabled = enabled;
+            NEON_Bridge_Latency.sequence = 0;
+            if (enabled) {
+                window.addEventListener('pointerdown', NEON_Bridge_Latency.onInput, true);
+                window.addEventListener('keydown', NEON_Bridge_Latency.onInput, true);
+            }
+            else {
+                window.removeEventListener('pointerdown', NEON_Bridge_Latency.onInput, true);
+                window.removeEventListener('keydown', NEON_Bridge_Latency.onInput, true);
+            }
+            Log.info('NEON latency probe', enabled ? 'enabled' : 'disabled');
+        };
+        NEON_Bridge_Latency.onInput = function () {
+            var sequence = ++NEON_Bridge_Latency.sequence;
+            requestAnimationFrame(function () {
+                var _a;
+                (_a = window.cefQuery) === null || _a === void 0 ? void 0 : _a.call(window, { request: JSON.stringify({ type: 'latency', sequence: sequence }) });
+            });
+        };
+        NEON_Bridge_Latency.sequence = 0;
+        NEON_Bridge_Latency.enabled = false;
+        return NEON_Bridge_Latency;
+    }());
     // Define the NEON Bridge to be called from Unreal
     window.NEON_Bridge_Web_Invoke = NEON.invoke;
+    window.NEON_Bridge_Latency_Enable = NEON_Bridge_Latency.enable;
     exports.default = NEON;
 });